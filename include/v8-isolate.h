@@ -854,6 +854,15 @@ class V8_EXPORT Isolate {
    */
   bool GetHeapCodeAndMetadataStatistics(HeapCodeStatistics* object_statistics);
 
+  /**
+   * Get statistics about the megamorphic stub caches.
+   *
+   * \param stub_cache_statistics The StubCacheStatistics object to fill in
+   *   statistics of the caches' sizes and use.
+   * \returns true on success.
+   */
+  bool GetStubCacheStatistics(StubCacheStatistics* stub_cache_statistics);
+
   /**
    * This API is experimental and may change significantly.
    *
@@ -6,6 +6,8 @@
 #ifndef INCLUDE_V8_REGEXP_H_
 #define INCLUDE_V8_REGEXP_H_
 
+#include <vector>
+
 #include "v8-local-handle.h"  // NOLINT(build/include_directory)
 #include "v8-object.h"        // NOLINT(build/include_directory)
 #include "v8config.h"         // NOLINT(build/include_directory)
@@ -101,6 +103,51 @@ class V8_EXPORT RegExp : public Object {
   static void CheckCast(Value* obj);
 };
 
+/**
+ * A set of regular expressions that can be matched against a subject string
+ * in a single pass, which is faster than matching them one at a time when the
+ * set is large. The set only reports which of its regular expressions match
+ * somewhere in the subject, not where they match.
+ *
+ * Only regular expressions that the linear-time engine can run and that don't
+ * contain assertions or lookbehinds can be added.
+ *
+ * The set allocates its state from the isolate it was created for, so it
+ * must be destroyed before that isolate is disposed. It must only be used
+ * while that isolate is entered.
+ */
+class V8_EXPORT RegExpSet {
+ public:
+  explicit RegExpSet(Isolate* isolate);
+  ~RegExpSet();
+
+  /**
+   * Adds a regular expression to the set. Returns false, leaving the set
+   * unchanged, if it is not supported. The index of the regular expression in
+   * the set is the number of regular expressions successfully added before.
+   */
+  bool Add(Local<RegExp> regexp);
+
+  /**
+   * Returns the number of regular expressions in the set.
+   */
+  int Size() const;
+
+  /**
+   * Returns the indices of the regular expressions that match in the
+   * subject, in increasing order. Sticky regular expressions only match at
+   * the start of the subject.
+   */
+  std::vector<int> Match(Local<String> subject);
+
+  RegExpSet(const RegExpSet&) = delete;
+  void operator=(const RegExpSet&) = delete;
+
+ private:
+  struct PrivateData;
+  PrivateData* private_;
+};
+
 }  // namespace v8
 
 #endif  // INCLUDE_V8_REGEXP_H_
@@ -856,6 +856,35 @@ class V8_EXPORT ScriptCompiler {
    */
   static CachedData* CreateCodeCacheForFunction(Local<Function> function);
 
+  /**
+   * Creates and returns a code cache for the specified unbound_script that
+   * only contains the bytecode of functions lazily compiled since the last
+   * code cache (full or delta) was created for it, or since it was compiled or
+   * deserialized if no code cache was created since. All other functions are
+   * serialized as uncompiled, which keeps the result small and cheap to
+   * produce. Use MergeCodeCacheDelta to add the functions to a script created
+   * from the earlier caches.
+   * Creating any code cache resets the list of lazily compiled functions, so
+   * it also resets the compile hints reported by
+   * Script::GetProducedCompileHints.
+   * The script must have been compiled with kProduceCompileHints, or
+   * deserialized from a code cache of such a script; otherwise this returns
+   * nullptr. The CachedData returned by this function should be owned by the
+   * caller.
+   */
+  static CachedData* CreateCodeCacheDelta(Local<UnboundScript> unbound_script);
+
+  /**
+   * Deserializes a code cache produced by CreateCodeCacheDelta and merges the
+   * functions it contains into unbound_script, which must have been compiled
+   * from the same source. Functions that are already compiled are kept.
+   * Returns false and sets cached_data->rejected if the cache can't be used,
+   * e.g. because it was produced for a different source.
+   */
+  static bool MergeCodeCacheDelta(Isolate* isolate,
+                                  Local<UnboundScript> unbound_script,
+                                  CachedData* cached_data);
+
  private:
   static V8_WARN_UNUSED_RESULT MaybeLocal<UnboundScript> CompileUnboundInternal(
       Isolate* isolate, Source* source, CompileOptions options,
@@ -233,6 +233,52 @@ class V8_EXPORT HeapCodeStatistics {
   friend class Isolate;
 };
 
+/**
+ * Statistics about the megamorphic stub caches of an isolate, i.e. the caches
+ * of property access handlers for sites that have seen many maps. They are
+ * summed up over the load, store and define-own caches.
+ */
+class V8_EXPORT StubCacheStatistics {
+ public:
+  StubCacheStatistics();
+  /** The number of entries in the cache tables. */
+  size_t table_entries() { return table_entries_; }
+  /** The memory used by the cache tables in bytes. */
+  size_t table_size() { return table_size_; }
+  /**
+   * The number of lookups in the caches from generated code, and how they
+   * were resolved. They are counted by generated code only if native code
+   * counters are enabled (--native-code-counters, and for the builtins
+   * v8_enable_snapshot_native_code_counters; both are off in release builds)
+   * and the embedder provides a counter lookup function, see
+   * Isolate::SetCounterFunction. They are zero otherwise, so release builds
+   * only report the table sizes and the runtime counts below.
+   */
+  size_t probes() { return probes_; }
+  size_t primary_hits() { return primary_hits_; }
+  size_t secondary_hits() { return secondary_hits_; }
+  size_t misses() { return misses_; }
+  /** The number of handlers added to the caches by the runtime. */
+  size_t updates() { return updates_; }
+  /** The number of cached handlers that were dropped to make room. */
+  size_t evictions() { return evictions_; }
+  /** The number of times a cache grew. */
+  size_t resizes() { return resizes_; }
+
+ private:
+  size_t table_entries_;
+  size_t table_size_;
+  size_t probes_;
+  size_t primary_hits_;
+  size_t secondary_hits_;
+  size_t misses_;
+  size_t updates_;
+  size_t evictions_;
+  size_t resizes_;
+
+  friend class Isolate;
+};
+
 }  // namespace v8
 
 #endif  // INCLUDE_V8_STATISTICS_H_
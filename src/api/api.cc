@@ -69,6 +69,7 @@
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap-write-barrier.h"
 #include "src/heap/safepoint.h"
+#include "src/ic/stub-cache.h"
 #include "src/init/bootstrapper.h"
 #include "src/init/icu_util.h"
 #include "src/init/startup-data-util.h"
@@ -121,6 +122,8 @@
 #include "src/profiler/heap-snapshot-generator-inl.h"
 #include "src/profiler/profile-generator-inl.h"
 #include "src/profiler/tick-sample.h"
+#include "src/regexp/experimental/experimental-interpreter.h"
+#include "src/regexp/experimental/experimental.h"
 #include "src/regexp/regexp-utils.h"
 #include "src/roots/static-roots.h"
 #include "src/runtime/runtime.h"
@@ -2900,6 +2903,39 @@ ScriptCompiler::CachedData* ScriptCompiler::CreateCodeCacheForFunction(
   return i::CodeSerializer::Serialize(i_isolate, shared);
 }
 
+// static
+ScriptCompiler::CachedData* ScriptCompiler::CreateCodeCacheDelta(
+    Local<UnboundScript> unbound_script) {
+  auto shared = Utils::OpenHandle(*unbound_script);
+  DCHECK(!InReadOnlySpace(*shared));
+  i::Isolate* i_isolate = i::GetIsolateFromWritableObject(*shared);
+  Utils::ApiCheck(!i_isolate->serializer_enabled(),
+                  "ScriptCompiler::CreateCodeCacheDelta",
+                  "Cannot create code cache while creating a snapshot");
+  DCHECK_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  DCHECK(shared->is_toplevel());
+  return i::CodeSerializer::Serialize(
+      i_isolate, shared, i::CodeSerializer::SerializeMode::kDelta);
+}
+
+// static
+bool ScriptCompiler::MergeCodeCacheDelta(Isolate* v8_isolate,
+                                         Local<UnboundScript> unbound_script,
+                                         CachedData* cached_data) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  auto shared = Utils::OpenDirectHandle(*unbound_script);
+  DCHECK(shared->is_toplevel());
+  i::Handle<i::Script> script(i::Cast<i::Script>(shared->script()), i_isolate);
+  // AlignedCachedData takes care of pointer-aligning the data.
+  i::AlignedCachedData aligned_data(cached_data->data, cached_data->length);
+  bool merged =
+      !i::CodeSerializer::DeserializeAndMerge(i_isolate, &aligned_data, script)
+           .is_null();
+  cached_data->rejected = aligned_data.rejected();
+  return merged;
+}
+
 MaybeLocal<Script> Script::Compile(Local<Context> context, Local<String> source,
                                    ScriptOrigin* origin) {
   if (origin) {
@@ -6616,6 +6652,17 @@ HeapCodeStatistics::HeapCodeStatistics()
       external_script_source_size_(0),
       cpu_profiler_metadata_size_(0) {}
 
+StubCacheStatistics::StubCacheStatistics()
+    : table_entries_(0),
+      table_size_(0),
+      probes_(0),
+      primary_hits_(0),
+      secondary_hits_(0),
+      misses_(0),
+      updates_(0),
+      evictions_(0),
+      resizes_(0) {}
+
 bool v8::V8::InitializeICU(const char* icu_data_file) {
   return i::InitializeICU(icu_data_file);
 }
@@ -8157,6 +8204,41 @@ MaybeLocal<v8::Object> v8::RegExp::Exec(Local<Context> context,
   RETURN_ESCAPED(result);
 }
 
+// Both the isolate and its allocator, which backs the zone, must outlive the
+// set (see the RegExpSet documentation).
+struct RegExpSet::PrivateData {
+  explicit PrivateData(i::Isolate* i)
+      : isolate(i), zone(i->allocator(), ZONE_NAME), dfa(&zone) {}
+  i::Isolate* isolate;
+  i::Zone zone;
+  i::ExperimentalRegExpLazyDfa dfa;
+};
+
+RegExpSet::RegExpSet(Isolate* v8_isolate)
+    : private_(new PrivateData(reinterpret_cast<i::Isolate*>(v8_isolate))) {}
+
+RegExpSet::~RegExpSet() { delete private_; }
+
+bool RegExpSet::Add(Local<RegExp> regexp) {
+  i::Isolate* i_isolate = private_->isolate;
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  return i::ExperimentalRegExp::AddToLazyDfa(
+      i_isolate, Utils::OpenDirectHandle(*regexp), &private_->dfa);
+}
+
+int RegExpSet::Size() const { return private_->dfa.program_count(); }
+
+std::vector<int> RegExpSet::Match(Local<String> subject) {
+  i::Isolate* i_isolate = private_->isolate;
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  i::Handle<i::String> string =
+      i::String::Flatten(i_isolate, Utils::OpenHandle(*subject));
+  i::DisallowGarbageCollection no_gc;
+  base::Vector<const int> matches =
+      private_->dfa.FindMatchingPrograms(*string, 0, false);
+  return std::vector<int>(matches.begin(), matches.end());
+}
+
 Local<v8::Array> v8::Array::New(Isolate* v8_isolate, int length) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
   API_RCS_SCOPE(i_isolate, Array, New);
@@ -10232,6 +10314,37 @@ bool Isolate::GetHeapCodeAndMetadataStatistics(
   return true;
 }
 
+bool Isolate::GetStubCacheStatistics(StubCacheStatistics* stub_cache_stats) {
+  if (!stub_cache_stats) return false;
+
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  *stub_cache_stats = StubCacheStatistics();
+  for (i::StubCache* stub_cache :
+       {i_isolate->load_stub_cache(), i_isolate->store_stub_cache(),
+        i_isolate->define_own_stub_cache()}) {
+    size_t entries = stub_cache->primary_table_size() +
+                     stub_cache->secondary_table_size();
+    stub_cache_stats->table_entries_ += entries;
+    stub_cache_stats->table_size_ += entries * sizeof(i::StubCache::Entry);
+    stub_cache_stats->updates_ += stub_cache->updates();
+    stub_cache_stats->evictions_ += stub_cache->evictions();
+    stub_cache_stats->resizes_ += stub_cache->resizes();
+  }
+
+  auto value = [](i::StatsCounter* counter) -> size_t {
+    return counter->Enabled() ? counter->Get() : 0;
+  };
+  i::Counters* counters = i_isolate->counters();
+  stub_cache_stats->probes_ = value(counters->megamorphic_stub_cache_probes());
+  stub_cache_stats->primary_hits_ =
+      value(counters->megamorphic_stub_cache_primary_hits());
+  stub_cache_stats->secondary_hits_ =
+      value(counters->megamorphic_stub_cache_secondary_hits());
+  stub_cache_stats->misses_ = value(counters->megamorphic_stub_cache_misses());
+
+  return true;
+}
+
 bool Isolate::MeasureMemory(std::unique_ptr<MeasureMemoryDelegate> delegate,
                             MeasureMemoryExecution execution) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
@@ -1194,7 +1194,8 @@ void CollectionsBuiltinsAssembler::FindOrderedHashTableEntryForStringKey(
   FindOrderedHashTableEntry<CollectionType>(
       table, hash,
       [&](TNode<Object> other_key, Label* if_same, Label* if_not_same) {
-        SameValueZeroString(key_tagged, other_key, if_same, if_not_same);
+        SameValueZeroString(key_tagged, hash, other_key, if_same,
+                            if_not_same);
       },
       result, entry_found, not_found);
 }
@@ -1260,13 +1261,24 @@ TNode<Uint32T> CollectionsBuiltinsAssembler::ComputeStringHash(
 }
 
 void CollectionsBuiltinsAssembler::SameValueZeroString(
-    TNode<String> key_string, TNode<Object> candidate_key, Label* if_same,
-    Label* if_not_same) {
+    TNode<String> key_string, TNode<Uint32T> key_hash,
+    TNode<Object> candidate_key, Label* if_same, Label* if_not_same) {
   // If the candidate is not a string, the keys are not equal.
   GotoIf(TaggedIsSmi(candidate_key), if_not_same);
   GotoIfNot(IsString(CAST(candidate_key)), if_not_same);
 
   GotoIf(TaggedEqual(key_string, candidate_key), if_same);
+
+  // Strings in the table had their hash computed when they were added, so
+  // a different hash rules out equality without comparing the characters.
+  // Chains hold about kLoadFactor entries, most of which are such misses.
+  Label compare_strings(this);
+  const TNode<Uint32T> candidate_hash =
+      LoadNameHash(CAST(candidate_key), &compare_strings);
+  GotoIf(Word32NotEqual(candidate_hash, key_hash), if_not_same);
+  Goto(&compare_strings);
+
+  BIND(&compare_strings);
   BranchIfStringEqual(key_string, CAST(candidate_key), if_same, if_not_same);
 }
 
@@ -2776,6 +2776,7 @@ bool Compiler::CollectSourcePositions(Isolate* isolate,
   // Prevent parallel tasks from being spawned by this job.
   flags.set_post_parallel_compile_tasks_for_eager_toplevel(false);
   flags.set_post_parallel_compile_tasks_for_lazy(false);
+  flags.set_post_parallel_compile_tasks_for_lazy_toplevel(false);
 
   UnoptimizedCompileState compile_state;
   ReusableUnoptimizedCompileState reusable_state(isolate);
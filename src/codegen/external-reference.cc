@@ -30,6 +30,7 @@
 #include "src/numbers/math-random.h"
 #include "src/objects/elements-kind.h"
 #include "src/objects/elements.h"
+#include "src/objects/lookup-cache.h"
 #include "src/objects/object-type.h"
 #include "src/objects/objects-inl.h"
 #include "src/objects/ordered-hash-table.h"
@@ -500,6 +501,10 @@ ExternalReference ExternalReference::date_cache_stamp(Isolate* isolate) {
   return ExternalReference(isolate->date_cache()->stamp_address());
 }
 
+ExternalReference ExternalReference::dictionary_lookup_cache(Isolate* isolate) {
+  return ExternalReference(isolate->dictionary_lookup_cache()->address());
+}
+
 // static
 ExternalReference
 ExternalReference::runtime_function_table_address_for_unittests(
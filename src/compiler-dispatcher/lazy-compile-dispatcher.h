@@ -107,6 +107,7 @@ class V8_EXPORT_PRIVATE LazyCompileDispatcher {
   FRIEND_TEST(LazyCompileDispatcherTest, AsyncAbortAllPendingWorkerTask);
   FRIEND_TEST(LazyCompileDispatcherTest, AsyncAbortAllRunningWorkerTask);
   FRIEND_TEST(LazyCompileDispatcherTest, CompileMultipleOnBackgroundThread);
+  FRIEND_TEST(LazyCompileDispatcherTest, ParallelCompileTasksForLazyToplevel);
 
   // JobTask for PostJob API.
   class JobTask;
@@ -26,6 +26,7 @@
 #include "src/utils/utils.h"
 
 #if V8_ENABLE_WEBASSEMBLY
+#include "src/wasm/wasm-code-manager.h"
 #include "src/wasm/wasm-deopt-data.h"
 #endif
 
@@ -498,8 +499,8 @@ base::OwnedVector<uint8_t> CodeGenerator::GetSourcePositionTable() {
 
 base::OwnedVector<uint8_t> CodeGenerator::GetProtectedInstructionsData() {
 #if V8_ENABLE_WEBASSEMBLY
-  return base::OwnedVector<uint8_t>::Of(
-      base::Vector<uint8_t>::cast(base::VectorOf(protected_instructions_)));
+  return wasm::WasmCode::EncodeProtectedInstructions(
+      base::VectorOf(protected_instructions_));
 #else
   return {};
 #endif  // V8_ENABLE_WEBASSEMBLY
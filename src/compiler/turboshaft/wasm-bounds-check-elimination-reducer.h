@@ -0,0 +1,219 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#if !V8_ENABLE_WEBASSEMBLY
+#error This header should only be included if WebAssembly is enabled.
+#endif  // !V8_ENABLE_WEBASSEMBLY
+
+#ifndef V8_COMPILER_TURBOSHAFT_WASM_BOUNDS_CHECK_ELIMINATION_REDUCER_H_
+#define V8_COMPILER_TURBOSHAFT_WASM_BOUNDS_CHECK_ELIMINATION_REDUCER_H_
+
+#include <optional>
+#include <utility>
+
+#include "src/compiler/turboshaft/analyzer-iterator.h"
+#include "src/compiler/turboshaft/assembler.h"
+#include "src/compiler/turboshaft/graph.h"
+#include "src/compiler/turboshaft/loop-finder.h"
+#include "src/compiler/turboshaft/operation-matcher.h"
+#include "src/compiler/turboshaft/operations.h"
+#include "src/compiler/turboshaft/sidetable.h"
+#include "src/compiler/turboshaft/snapshot-table.h"
+#include "src/compiler/turboshaft/utils.h"
+#include "src/wasm/wasm-limits.h"
+#include "src/zone/zone-containers.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+#include "src/compiler/turboshaft/define-assembler-macros.inc"
+
+// Explicit memory bounds checks (emitted for memory64 and whenever the trap
+// handler cannot be used) have the form
+//
+//   TrapIfNot(UintPtrLessThan(index, WordPtrSub(memory_size, end_offset)))
+//
+// where {end_offset} is the static offset plus the access size minus one. A
+// check of {index} with end offset {e1} that did not trap proves
+// {index < memory_size - e1}. Any later check of {index + c} against the same
+// memory size with end offset {e2} then cannot trap if {c + e2 <= e1}; this is
+// the common case of accessing several fields of a struct or unrolled array
+// elements through the same base pointer.
+//
+// The analysis walks the input graph in dominator order and records the
+// largest checked end offset per (index, memory size) pair. Facts only flow
+// from a block to the blocks it dominates, so no merging is required. The
+// memory size is part of the key: it is reloaded after anything that can grow
+// the memory, which conservatively invalidates all facts about it.
+class WasmBoundsCheckEliminationAnalyzer {
+ public:
+  WasmBoundsCheckEliminationAnalyzer(const Graph& graph, Zone* phase_zone)
+      : graph_(graph),
+        phase_zone_(phase_zone),
+        matcher_(graph),
+        keys_(phase_zone),
+        checked_end_offsets_(phase_zone),
+        block_to_snapshot_mapping_(graph.block_count(), phase_zone),
+        redundant_checks_(graph.op_id_count(), false, phase_zone, &graph) {}
+
+  void Run() {
+    LoopFinder loop_finder(phase_zone_, &graph_);
+    AnalyzerIterator iterator(phase_zone_, graph_, loop_finder);
+    while (iterator.HasNext()) {
+      ProcessBlock(*iterator.Next());
+    }
+  }
+
+  bool IsRedundant(OpIndex trap) const { return redundant_checks_[trap]; }
+
+ private:
+  using CheckedEndOffsets = SnapshotTable<std::optional<uint64_t>>;
+  using Key = CheckedEndOffsets::Key;
+  using Snapshot = CheckedEndOffsets::Snapshot;
+
+  struct BoundsCheck {
+    OpIndex index;
+    OpIndex memory_size;
+    uint64_t end_offset;
+  };
+
+  void ProcessBlock(const Block& block) {
+    if (const Block* dominator = block.GetDominator()) {
+      DCHECK(block_to_snapshot_mapping_[dominator->index()].has_value());
+      checked_end_offsets_.StartNewSnapshot(
+          *block_to_snapshot_mapping_[dominator->index()]);
+    } else {
+      checked_end_offsets_.StartNewSnapshot();
+    }
+
+    for (OpIndex op_idx : graph_.OperationIndices(block)) {
+      const TrapIfOp* trap = graph_.Get(op_idx).TryCast<TrapIfOp>();
+      if (trap == nullptr) continue;
+      std::optional<BoundsCheck> check = MatchBoundsCheck(*trap);
+      if (!check.has_value()) continue;
+      if (ShouldSkipOptimizationStep()) continue;
+
+      if (IsImpliedByDominatingCheck(*check)) {
+        redundant_checks_[op_idx] = true;
+        continue;
+      }
+      checked_end_offsets_.Set(GetKey(check->index, check->memory_size),
+                               check->end_offset);
+    }
+
+    block_to_snapshot_mapping_[block.index()] = checked_end_offsets_.Seal();
+  }
+
+  bool IsImpliedByDominatingCheck(const BoundsCheck& check) {
+    if (IsImpliedBy(check.index, 0, check)) return true;
+    // {index + c} is in bounds if {index} was checked with a large enough
+    // end offset. The addition cannot overflow in that case, since {index} is
+    // below the memory size.
+    V<Word> base;
+    V<Word> offset;
+    WordBinopOp::Kind kind;
+    WordRepresentation rep;
+    uint64_t constant;
+    if (matcher_.MatchWordBinop(check.index, &base, &offset, &kind, &rep) &&
+        kind == WordBinopOp::Kind::kAdd &&
+        rep == WordRepresentation::WordPtr() &&
+        matcher_.MatchIntegralWordConstant(offset, rep, &constant)) {
+      return IsImpliedBy(base, constant, check);
+    }
+    return false;
+  }
+
+  bool IsImpliedBy(OpIndex index, uint64_t index_offset,
+                   const BoundsCheck& check) {
+    auto it = keys_.find({index, check.memory_size});
+    if (it == keys_.end()) return false;
+    std::optional<uint64_t> checked = checked_end_offsets_.Get(it->second);
+    if (!checked.has_value() || index_offset > *checked) return false;
+    return check.end_offset <= *checked - index_offset;
+  }
+
+  std::optional<BoundsCheck> MatchBoundsCheck(const TrapIfOp& trap) const {
+    if (!trap.negated || trap.trap_id != TrapId::kTrapMemOutOfBounds) {
+      return std::nullopt;
+    }
+    const ComparisonOp* comparison =
+        graph_.Get(trap.condition()).TryCast<ComparisonOp>();
+    if (comparison == nullptr ||
+        comparison->kind != ComparisonOp::Kind::kUnsignedLessThan ||
+        comparison->rep != WordRepresentation::WordPtr()) {
+      return std::nullopt;
+    }
+
+    // The limit is {memory_size - end_offset}, which may have been
+    // canonicalized to {memory_size + (-end_offset)}, or just {memory_size} if
+    // the end offset is zero.
+    OpIndex memory_size = comparison->right();
+    uint64_t end_offset = 0;
+    V<Word> left;
+    V<Word> right;
+    WordBinopOp::Kind kind;
+    WordRepresentation rep;
+    uint64_t constant;
+    if (matcher_.MatchWordBinop(memory_size, &left, &right, &kind, &rep) &&
+        rep == WordRepresentation::WordPtr() &&
+        matcher_.MatchIntegralWordConstant(right, rep, &constant)) {
+      if (kind == WordBinopOp::Kind::kSub) {
+        memory_size = left;
+        end_offset = constant;
+      } else if (kind == WordBinopOp::Kind::kAdd) {
+        memory_size = left;
+        end_offset = (uint64_t{0} - constant) & rep.MaxUnsignedValue();
+      }
+    }
+    // Anything larger cannot come from a static offset, e.g. an addition of a
+    // small positive constant.
+    if (end_offset > wasm::max_mem64_bytes()) return std::nullopt;
+
+    return BoundsCheck{comparison->left(), memory_size, end_offset};
+  }
+
+  Key GetKey(OpIndex index, OpIndex memory_size) {
+    auto [it, inserted] = keys_.try_emplace({index, memory_size});
+    if (inserted) it->second = checked_end_offsets_.NewKey();
+    return it->second;
+  }
+
+  const Graph& graph_;
+  Zone* phase_zone_;
+  OperationMatcher matcher_;
+  ZoneMap<std::pair<OpIndex, OpIndex>, Key> keys_;
+  CheckedEndOffsets checked_end_offsets_;
+  FixedBlockSidetable<std::optional<Snapshot>> block_to_snapshot_mapping_;
+  FixedOpIndexSidetable<bool> redundant_checks_;
+};
+
+template <class Next>
+class WasmBoundsCheckEliminationReducer : public Next {
+ public:
+  TURBOSHAFT_REDUCER_BOILERPLATE(WasmBoundsCheckElimination)
+
+  void Analyze() {
+    if (v8_flags.turboshaft_wasm_bounds_check_elimination) {
+      analyzer_.Run();
+    }
+    Next::Analyze();
+  }
+
+  V<None> REDUCE_INPUT_GRAPH(TrapIf)(V<None> ig_index, const TrapIfOp& trap) {
+    if (v8_flags.turboshaft_wasm_bounds_check_elimination &&
+        analyzer_.IsRedundant(ig_index)) {
+      return V<None>::Invalid();
+    }
+    return Next::ReduceInputGraphTrapIf(ig_index, trap);
+  }
+
+ private:
+  WasmBoundsCheckEliminationAnalyzer analyzer_{__ input_graph(),
+                                               __ phase_zone()};
+};
+
+#include "src/compiler/turboshaft/undef-assembler-macros.inc"
+
+}  // namespace v8::internal::compiler::turboshaft
+
+#endif  // V8_COMPILER_TURBOSHAFT_WASM_BOUNDS_CHECK_ELIMINATION_REDUCER_H_
@@ -14,6 +14,7 @@
 #include "src/compiler/turboshaft/phase.h"
 #include "src/compiler/turboshaft/value-numbering-reducer.h"
 #include "src/compiler/turboshaft/variable-reducer.h"
+#include "src/compiler/turboshaft/wasm-bounds-check-elimination-reducer.h"
 #include "src/compiler/turboshaft/wasm-lowering-reducer.h"
 #include "src/numbers/conversions-inl.h"
 #include "src/roots/roots-inl.h"
@@ -23,9 +24,9 @@ namespace v8::internal::compiler::turboshaft {
 void WasmOptimizePhase::Run(PipelineData* data, Zone* temp_zone) {
   UnparkedScopeIfNeeded scope(data->broker(),
                               v8_flags.turboshaft_trace_reduction);
-  CopyingPhase<LateEscapeAnalysisReducer, MachineOptimizationReducer,
-               MemoryOptimizationReducer, BranchEliminationReducer,
-               LateLoadEliminationReducer,
+  CopyingPhase<WasmBoundsCheckEliminationReducer, LateEscapeAnalysisReducer,
+               MachineOptimizationReducer, MemoryOptimizationReducer,
+               BranchEliminationReducer, LateLoadEliminationReducer,
                ValueNumberingReducer>::Run(data, temp_zone);
 }
 
@@ -2079,6 +2079,21 @@ void IrRegExpData::IrRegExpDataVerify(Isolate* isolate) {
   CHECK(IsSmi(TaggedField<Object>::load(*this, kCaptureCountOffset)));
   CHECK(IsSmi(TaggedField<Object>::load(*this, kTicksUntilTierUpOffset)));
   CHECK(IsSmi(TaggedField<Object>::load(*this, kBacktrackLimitOffset)));
+  CHECK_IMPLIES(
+      IsSmi(required_literal()),
+      Smi::ToInt(required_literal()) == JSRegExp::kUninitializedValue ||
+          required_literal() == Smi::zero());
+  CHECK_IMPLIES(!IsSmi(required_literal()), IsString(required_literal()));
+  CHECK_IMPLIES(IsString(required_literal()),
+                required_literal_max_offset() >= 0);
+  CHECK(IsSmi(
+      TaggedField<Object>::load(*this, kRequiredLiteralMaxOffsetOffset)));
+  CHECK_IMPLIES(
+      has_experimental_lazy_dfa(),
+      type_tag() == RegExpData::Type::EXPERIMENTAL ||
+          v8_flags.enable_experimental_regexp_engine_on_excessive_backtracks);
+  CHECK_IMPLIES(has_experimental_lazy_dfa(),
+                IsTrustedForeign(experimental_lazy_dfa()));
 
   switch (type_tag()) {
     case RegExpData::Type::EXPERIMENTAL: {
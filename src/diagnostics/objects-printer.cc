@@ -904,6 +904,11 @@ void IrRegExpData::IrRegExpDataPrint(std::ostream& os) {
   os << "\n - capture_count: " << max_register_count();
   os << "\n - ticks_until_tier_up: " << max_register_count();
   os << "\n - backtrack_limit: " << max_register_count();
+  os << "\n - required_literal: " << Brief(required_literal());
+  os << "\n - required_literal_max_offset: " << required_literal_max_offset();
+  if (has_experimental_lazy_dfa()) {
+    os << "\n - experimental_lazy_dfa: " << Brief(experimental_lazy_dfa());
+  }
   os << "\n";
 }
 
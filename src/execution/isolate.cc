@@ -107,6 +107,7 @@
 #include "src/profiler/heap-profiler.h"
 #include "src/profiler/tracing-cpu-profiler.h"
 #include "src/regexp/regexp-stack.h"
+#include "src/regexp/regexp-tier-up-dispatcher.h"
 #include "src/roots/roots.h"
 #include "src/roots/static-roots.h"
 #include "src/sandbox/js-dispatch-table-inl.h"
@@ -4286,6 +4287,10 @@ void Isolate::Deinit() {
   // use those.
   cancelable_task_manager()->CancelAndWait();
 
+  // Wait for regexp tier-up front ends and release their global handles.
+  delete regexp_tier_up_dispatcher_;
+  regexp_tier_up_dispatcher_ = nullptr;
+
   // Cancel all compiler tasks.
 #ifdef V8_ENABLE_SPARKPLUG
   delete baseline_batch_compiler_;
@@ -4486,6 +4491,8 @@ Isolate::~Isolate() {
 
   delete descriptor_lookup_cache_;
   descriptor_lookup_cache_ = nullptr;
+  delete dictionary_lookup_cache_;
+  dictionary_lookup_cache_ = nullptr;
 
   delete load_stub_cache_;
   load_stub_cache_ = nullptr;
@@ -5294,6 +5301,7 @@ bool Isolate::Init(SnapshotData* startup_snapshot_data,
 
   compilation_cache_ = new CompilationCache(this);
   descriptor_lookup_cache_ = new DescriptorLookupCache();
+  dictionary_lookup_cache_ = new DictionaryLookupCache();
   global_handles_ = new GlobalHandles(this);
   eternal_handles_ = new EternalHandles();
   bootstrapper_ = new Bootstrapper(this);
@@ -5303,6 +5311,7 @@ bool Isolate::Init(SnapshotData* startup_snapshot_data,
   define_own_stub_cache_ = new StubCache(this);
   materialized_object_store_ = new MaterializedObjectStore(this);
   regexp_stack_ = new RegExpStack();
+  regexp_tier_up_dispatcher_ = new RegExpTierUpDispatcher(this);
   date_cache_ = new DateCache();
   heap_profiler_ = new HeapProfiler(heap());
   interpreter_ = new interpreter::Interpreter(this);
@@ -123,6 +123,7 @@ class Counters;
 class Debug;
 class Deoptimizer;
 class DescriptorLookupCache;
+class DictionaryLookupCache;
 class EmbeddedFileWriterInterface;
 class EternalHandles;
 class GlobalHandles;
@@ -142,6 +143,7 @@ class PersistentHandles;
 class PersistentHandlesList;
 class ReadOnlyArtifacts;
 class RegExpStack;
+class RegExpTierUpDispatcher;
 class RootVisitor;
 class SetupIsolateDelegate;
 class SharedStructTypeRegistry;
@@ -1353,6 +1355,10 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
     return descriptor_lookup_cache_;
   }
 
+  DictionaryLookupCache* dictionary_lookup_cache() const {
+    return dictionary_lookup_cache_;
+  }
+
   V8_INLINE HandleScopeData* handle_scope_data() {
     return &isolate_data_.handle_scope_data_;
   }
@@ -1407,6 +1413,11 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 
   RegExpStack* regexp_stack() const { return regexp_stack_; }
 
+  RegExpTierUpDispatcher* regexp_tier_up_dispatcher() const {
+    DCHECK_NOT_NULL(regexp_tier_up_dispatcher_);
+    return regexp_tier_up_dispatcher_;
+  }
+
   size_t total_regexp_code_generated() const {
     return total_regexp_code_generated_;
   }
@@ -2430,6 +2441,7 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   StackTrace::StackTraceOptions stack_trace_for_uncaught_exceptions_options_ =
       StackTrace::kOverview;
   DescriptorLookupCache* descriptor_lookup_cache_ = nullptr;
+  DictionaryLookupCache* dictionary_lookup_cache_ = nullptr;
   HandleScopeImplementer* handle_scope_implementer_ = nullptr;
   UnicodeCache* unicode_cache_ = nullptr;
   AccountingAllocator* allocator_ = nullptr;
@@ -2452,6 +2464,7 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
       regexp_macro_assembler_canonicalize_;
 #endif  // !V8_INTL_SUPPORT
   RegExpStack* regexp_stack_ = nullptr;
+  RegExpTierUpDispatcher* regexp_tier_up_dispatcher_ = nullptr;
   std::vector<int> regexp_indices_;
   DateCache* date_cache_ = nullptr;
   base::RandomNumberGenerator* random_number_generator_ = nullptr;
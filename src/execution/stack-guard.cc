@@ -334,6 +334,11 @@ Tagged<Object> StackGuard::HandleInterrupts(InterruptLevel level) {
     TRACE_EVENT0("v8.wasm", "V8.WasmCodeGC");
     wasm::GetWasmEngine()->ReportLiveCodeFromStackForGC(isolate_);
   }
+
+  if (TestAndClear(&interrupt_flags, WASM_TIER_UP)) {
+    TRACE_EVENT0("v8.wasm", "V8.WasmTierUp");
+    wasm::GetWasmEngine()->ProcessTieringSamples(isolate_);
+  }
 #endif  // V8_ENABLE_WEBASSEMBLY
 
   if (TestAndClear(&interrupt_flags, DEOPT_MARKED_ALLOCATION_SITES)) {
@@ -76,7 +76,8 @@ class V8_EXPORT_PRIVATE V8_NODISCARD StackGuard final {
   V(INSTALL_MAGLEV_CODE, InstallMaglevCode, 9, InterruptLevel::kAnyEffect)     \
   V(GLOBAL_SAFEPOINT, GlobalSafepoint, 10, InterruptLevel::kNoHeapWrites)      \
   V(START_INCREMENTAL_MARKING, StartIncrementalMarking, 11,                    \
-    InterruptLevel::kNoHeapWrites)
+    InterruptLevel::kNoHeapWrites)                                             \
+  V(WASM_TIER_UP, WasmTierUp, 12, InterruptLevel::kAnyEffect)
 
 #define V(NAME, Name, id, interrupt_level)                   \
   inline bool Check##Name() { return CheckInterrupt(NAME); } \
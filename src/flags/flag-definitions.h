@@ -915,6 +915,9 @@ DEFINE_IMPLICATION(jit_fuzzing, wasm_inlining_ignore_call_counts)
 DEFINE_BOOL(use_ic, true, "use inline caching")
 DEFINE_BOOL(lazy_feedback_allocation, true, "Allocate feedback vectors lazily")
 DEFINE_BOOL(stress_ic, false, "exercise interesting paths in ICs more often")
+DEFINE_BOOL(stub_cache_resize, false,
+            "grow the megamorphic stub caches when they keep evicting live "
+            "entries")
 
 // Flags for Ignition.
 DEFINE_BOOL(ignition_elide_noneffectful_bytecodes, true,
@@ -1382,6 +1385,11 @@ DEFINE_WEAK_IMPLICATION(future, turboshaft_wasm)
 DEFINE_BOOL(turboshaft_wasm_load_elimination, false,
             "enable Turboshaft's WasmLoadElimination")
 DEFINE_WEAK_IMPLICATION(turboshaft_wasm, turboshaft_wasm_load_elimination)
+DEFINE_BOOL(turboshaft_wasm_bounds_check_elimination, false,
+            "enable Turboshaft's elimination of explicit Wasm memory bounds "
+            "checks that are implied by dominating checks")
+DEFINE_WEAK_IMPLICATION(turboshaft_wasm,
+                        turboshaft_wasm_bounds_check_elimination)
 
 DEFINE_BOOL(turboshaft_instruction_selection, true,
             "run instruction selection on Turboshaft IR directly")
@@ -1552,6 +1560,18 @@ DEFINE_BOOL(wasm_sync_tier_up, false,
             "run tier up jobs synchronously for testing")
 DEFINE_INT(wasm_tiering_budget, 13'000'000,
            "budget for dynamic tiering (rough approximation of bytes executed")
+DEFINE_BOOL(wasm_sampling_tier_up, false,
+            "detect hot Liftoff functions for dynamic tier up by sampling the "
+            "executing code instead of using tiering budgets")
+DEFINE_NEG_NEG_IMPLICATION(wasm_dynamic_tiering, wasm_sampling_tier_up)
+DEFINE_NEG_IMPLICATION(predictable, wasm_sampling_tier_up)
+DEFINE_NEG_IMPLICATION(single_threaded, wasm_sampling_tier_up)
+DEFINE_INT(wasm_sampling_tier_up_interval, 1000,
+           "interval between samples for --wasm-sampling-tier-up (in "
+           "microseconds)")
+DEFINE_INT(wasm_sampling_tier_up_threshold, 4,
+           "number of samples which trigger tier up of a Liftoff function "
+           "with --wasm-sampling-tier-up")
 DEFINE_INT(wasm_wrapper_tiering_budget, wasm::kGenericWrapperBudget,
            "budget for wrapper tierup (number of calls until tier-up)")
 DEFINE_INT(max_wasm_functions, wasm::kV8MaxWasmDefinedFunctions,
@@ -1590,6 +1610,8 @@ DEFINE_IMPLICATION(liftoff_only, liftoff)
 DEFINE_NEG_IMPLICATION(liftoff_only, wasm_tier_up)
 DEFINE_NEG_IMPLICATION(liftoff_only, wasm_dynamic_tiering)
 DEFINE_NEG_IMPLICATION(fuzzing, liftoff_only)
+DEFINE_BOOL(liftoff_loop_locals_in_registers, false,
+            "keep locals in registers across loop headers in Liftoff code")
 DEFINE_DEBUG_BOOL(
     enable_testing_opcode_in_wasm, false,
     "enables a testing opcode in wasm that is only implemented in TurboFan")
@@ -1751,6 +1773,13 @@ DEFINE_EXPERIMENTAL_FEATURE(
     wasm_lazy_validation,
     "enable lazy validation for lazily compiled wasm functions")
 DEFINE_WEAK_IMPLICATION(wasm_lazy_validation, wasm_lazy_compilation)
+DEFINE_BOOL(wasm_lazy_deserialization, false,
+            "deserialize cached TurboFan code of wasm functions on their first "
+            "call instead of when loading the module")
+DEFINE_EXPERIMENTAL_FEATURE(
+    wasm_position_independent_calls,
+    "emit direct calls in optimized wasm code through the instance's jump "
+    "table pointer instead of near calls that get patched on relocation")
 DEFINE_BOOL(wasm_simd_ssse3_codegen, false, "allow wasm SIMD SSSE3 codegen")
 
 DEFINE_BOOL(wasm_code_gc, true, "enable garbage collection of wasm code")
@@ -2379,6 +2408,9 @@ DEFINE_BOOL(deopt_to_baseline, false,
             "deoptimize to baseline code when available")
 
 DEFINE_BOOL(trace_serializer, false, "print code serializer trace")
+DEFINE_BOOL(code_cache_skip_old_bytecode, false,
+            "serialize functions whose bytecode is old enough to be flushed as "
+            "uncompiled, so that they are only compiled again on first call")
 #ifdef DEBUG
 DEFINE_BOOL(external_reference_stats, false,
             "print statistics on external references used during serialization")
@@ -2403,6 +2435,14 @@ DEFINE_IMPLICATION(parallel_compile_tasks_for_eager_toplevel,
 DEFINE_BOOL(parallel_compile_tasks_for_lazy, false,
             "spawn parallel compile tasks for all lazily compiled functions")
 DEFINE_IMPLICATION(parallel_compile_tasks_for_lazy, lazy_compile_dispatcher)
+DEFINE_BOOL(parallel_compile_tasks_for_lazy_toplevel, false,
+            "spawn parallel compile tasks for lazily compiled, top-level "
+            "functions")
+DEFINE_IMPLICATION(parallel_compile_tasks_for_lazy_toplevel,
+                   lazy_compile_dispatcher)
+DEFINE_INT(parallel_compile_tasks_min_function_size, 0,
+           "minimum source size (in characters) of a lazily compiled function "
+           "for which a parallel compile task is posted")
 
 // cpu-profiler.cc
 DEFINE_INT(cpu_profiler_sampling_interval, 1000,
@@ -2655,6 +2695,11 @@ DEFINE_NEG_IMPLICATION(regexp_interpret_all, regexp_tier_up)
 DEFINE_INT(regexp_tier_up_ticks, 1,
            "set the number of executions for the regexp interpreter before "
            "tiering-up to the compiler")
+DEFINE_BOOL(regexp_concurrent_tier_up, false,
+            "parse and analyze regexps for tier-up on a background thread "
+            "while the interpreter keeps matching")
+DEFINE_NEG_IMPLICATION(single_threaded, regexp_concurrent_tier_up)
+DEFINE_NEG_IMPLICATION(predictable, regexp_concurrent_tier_up)
 DEFINE_BOOL(regexp_peephole_optimization, REGEXP_PEEPHOLE_OPTIMIZATION_BOOL,
             "enable peephole optimization for regexp bytecode")
 DEFINE_BOOL(trace_regexp_peephole_optimization, false,
@@ -2663,6 +2708,14 @@ DEFINE_BOOL(trace_regexp_bytecodes, false, "trace regexp bytecode execution")
 DEFINE_BOOL(trace_regexp_assembler, false,
             "trace regexp macro assembler calls.")
 DEFINE_BOOL(trace_regexp_parser, false, "trace regexp parsing")
+DEFINE_BOOL(regexp_required_literal_prefilter, true,
+            "search for a literal that every match contains before running "
+            "an irregexp regexp from the runtime")
+DEFINE_BOOL(regexp_global_results_cache, true,
+            "cache the matches of global replace and match calls per regexp "
+            "and subject")
+DEFINE_BOOL(trace_regexp_global_results_cache, false,
+            "trace hits and misses of the global regexp results cache")
 DEFINE_BOOL(trace_regexp_tier_up, false, "trace regexp tiering up execution")
 DEFINE_BOOL(trace_regexp_graph, false, "trace the regexp graph")
 
@@ -2679,6 +2732,9 @@ DEFINE_IMPLICATION(experimental_regexp_engine_capture_group_opt,
 DEFINE_UINT64(experimental_regexp_engine_capture_group_opt_max_memory_usage,
               1024,
               "maximum memory usage in MB allowed for experimental engine")
+DEFINE_BOOL(experimental_regexp_engine_lazy_dfa, false,
+            "check for a match with a lazily built DFA before running the "
+            "experimental regexp engine")
 DEFINE_BOOL(trace_experimental_regexp_engine, false,
             "trace execution of experimental regexp engine")
 
@@ -3173,6 +3229,7 @@ DEFINE_NEG_IMPLICATION(predictable, stress_concurrent_inlining)
 DEFINE_NEG_IMPLICATION(predictable, lazy_compile_dispatcher)
 DEFINE_NEG_IMPLICATION(predictable, parallel_compile_tasks_for_eager_toplevel)
 DEFINE_NEG_IMPLICATION(predictable, parallel_compile_tasks_for_lazy)
+DEFINE_NEG_IMPLICATION(predictable, parallel_compile_tasks_for_lazy_toplevel)
 #ifdef V8_ENABLE_MAGLEV
 DEFINE_NEG_IMPLICATION(predictable, maglev_deopt_data_on_background)
 DEFINE_NEG_IMPLICATION(predictable, maglev_build_code_on_background)
@@ -3207,6 +3264,8 @@ DEFINE_NEG_IMPLICATION(single_threaded, lazy_compile_dispatcher)
 DEFINE_NEG_IMPLICATION(single_threaded,
                        parallel_compile_tasks_for_eager_toplevel)
 DEFINE_NEG_IMPLICATION(single_threaded, parallel_compile_tasks_for_lazy)
+DEFINE_NEG_IMPLICATION(single_threaded,
+                       parallel_compile_tasks_for_lazy_toplevel)
 #ifdef V8_ENABLE_MAGLEV
 DEFINE_NEG_IMPLICATION(single_threaded, maglev_deopt_data_on_background)
 DEFINE_NEG_IMPLICATION(single_threaded, maglev_build_code_on_background)
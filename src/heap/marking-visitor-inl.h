@@ -407,50 +407,14 @@ int MarkingVisitorBase<ConcreteVisitor>::VisitSharedFunctionInfo(
 template <typename ConcreteVisitor>
 bool MarkingVisitorBase<ConcreteVisitor>::HasBytecodeArrayForFlushing(
     Tagged<SharedFunctionInfo> sfi) const {
-  if (IsFlushingDisabled(code_flush_mode_)) return false;
-
-  // TODO(rmcilroy): Enable bytecode flushing for resumable functions.
-  if (IsResumableFunction(sfi->kind()) || !sfi->allows_lazy_compilation()) {
-    return false;
-  }
-
-  // Get a snapshot of the function data field, and if it is a bytecode array,
-  // check if it is old. Note, this is done this way since this function can be
-  // called by the concurrent marker.
-  Tagged<Object> data = sfi->GetTrustedData(heap_->isolate());
-  if (IsCode(data)) {
-    Tagged<Code> baseline_code = Cast<Code>(data);
-    DCHECK_EQ(baseline_code->kind(), CodeKind::BASELINE);
-    // If baseline code flushing isn't enabled and we have baseline data on SFI
-    // we cannot flush baseline / bytecode.
-    if (!IsBaselineCodeFlushingEnabled(code_flush_mode_)) return false;
-    data = baseline_code->bytecode_or_interpreter_data();
-  } else if (!IsByteCodeFlushingEnabled(code_flush_mode_)) {
-    // If bytecode flushing isn't enabled and there is no baseline code there is
-    // nothing to flush.
-    return false;
-  }
-
-  return IsBytecodeArray(data);
+  return sfi->HasBytecodeArrayForFlushing(heap_->isolate(), code_flush_mode_);
 }
 
 template <typename ConcreteVisitor>
 bool MarkingVisitorBase<ConcreteVisitor>::ShouldFlushCode(
     Tagged<SharedFunctionInfo> sfi) const {
-  return IsStressFlushingEnabled(code_flush_mode_) || IsOld(sfi);
-}
-
-template <typename ConcreteVisitor>
-bool MarkingVisitorBase<ConcreteVisitor>::IsOld(
-    Tagged<SharedFunctionInfo> sfi) const {
-  if (v8_flags.flush_code_based_on_time) {
-    return sfi->age() >= v8_flags.bytecode_old_time;
-  } else if (v8_flags.flush_code_based_on_tab_visibility) {
-    return isolate_in_background_ ||
-           V8_UNLIKELY(sfi->age() == SharedFunctionInfo::kMaxAge);
-  } else {
-    return sfi->age() >= v8_flags.bytecode_old_age;
-  }
+  return IsStressFlushingEnabled(code_flush_mode_) ||
+         sfi->HasOldBytecode(isolate_in_background_);
 }
 
 template <typename ConcreteVisitor>
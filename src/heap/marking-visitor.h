@@ -203,7 +203,6 @@ class MarkingVisitorBase : public ConcurrentHeapVisitor<int, ConcreteVisitor> {
   bool ShouldFlushBaselineCode(Tagged<JSFunction> js_function) const;
 
   bool HasBytecodeArrayForFlushing(Tagged<SharedFunctionInfo> sfi) const;
-  bool IsOld(Tagged<SharedFunctionInfo> sfi) const;
   void MakeOlder(Tagged<SharedFunctionInfo> sfi) const;
 
   MarkingWorklists::Local* const local_marking_worklists_;
@@ -1332,11 +1332,13 @@ void Heap::CreateInitialMutableObjects() {
   // Unchecked to skip failing checks since required roots are uninitialized.
   set_basic_block_profiling_data(roots.unchecked_empty_array_list());
 
-  // Allocate cache for string split and regexp-multiple.
+  // Allocate cache for string split, regexp-multiple and global matches.
   set_string_split_cache(*factory->NewFixedArray(
       RegExpResultsCache::kRegExpResultsCacheSize, AllocationType::kOld));
   set_regexp_multiple_cache(*factory->NewFixedArray(
       RegExpResultsCache::kRegExpResultsCacheSize, AllocationType::kOld));
+  set_regexp_global_matches_cache(*factory->NewFixedArray(
+      RegExpResultsCache::kRegExpResultsCacheSize, AllocationType::kOld));
 
   // Allocate FeedbackCell for builtins.
   DirectHandle<FeedbackCell> many_closures_cell =
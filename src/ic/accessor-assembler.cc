@@ -21,6 +21,7 @@
 #include "src/objects/feedback-vector.h"
 #include "src/objects/foreign.h"
 #include "src/objects/heap-number.h"
+#include "src/objects/lookup-cache.h"
 #include "src/objects/megadom-handler.h"
 #include "src/objects/module.h"
 #include "src/objects/objects-inl.h"
@@ -859,8 +860,8 @@ void AccessorAssembler::HandleLoadICSmiHandlerLoadNamedCase(
         CAST(LoadSlowProperties(CAST(holder)));
     TVARIABLE(IntPtrT, var_name_index);
     Label found(this, &var_name_index);
-    NameDictionaryLookup<PropertyDictionary>(properties, CAST(p->name()),
-                                             &found, &var_name_index, miss);
+    PropertyDictionaryLookupWithCache(properties, CAST(p->name()), &found,
+                                      &var_name_index, miss);
     BIND(&found);
     {
       TVARIABLE(Uint32T, var_details);
@@ -2935,9 +2936,8 @@ void AccessorAssembler::GenericPropertyLoad(
     Label dictionary_found(this, &var_name_index);
     TNode<PropertyDictionary> properties =
         CAST(LoadSlowProperties(CAST(lookup_start_object)));
-    NameDictionaryLookup<PropertyDictionary>(properties, name,
-                                             &dictionary_found, &var_name_index,
-                                             &lookup_prototype_chain);
+    PropertyDictionaryLookupWithCache(properties, name, &dictionary_found,
+                                      &var_name_index, &lookup_prototype_chain);
     BIND(&dictionary_found);
     {
       LoadPropertyFromDictionary<PropertyDictionary>(
@@ -3033,7 +3033,8 @@ enum AccessorAssembler::StubCacheTable : int {
   kSecondary = static_cast<int>(StubCache::kSecondary)
 };
 
-TNode<IntPtrT> AccessorAssembler::StubCachePrimaryOffset(TNode<Name> name,
+TNode<IntPtrT> AccessorAssembler::StubCachePrimaryOffset(StubCache* stub_cache,
+                                                         TNode<Name> name,
                                                          TNode<Map> map) {
   // Compute the hash of the name (use entire hash field).
   TNode<Uint32T> raw_hash_field = LoadNameRawHash(name);
@@ -3051,15 +3052,16 @@ TNode<IntPtrT> AccessorAssembler::StubCachePrimaryOffset(TNode<Name> name,
       WordXor(map_word, WordShr(map_word, StubCache::kPrimaryTableBits))));
   // Base the offset on a simple combination of name and map.
   TNode<Word32T> hash = Int32Add(raw_hash_field, map32);
-  uint32_t mask = (StubCache::kPrimaryTableSize - 1)
-                  << StubCache::kCacheIndexShift;
-  TNode<UintPtrT> result =
-      ChangeUint32ToWord(Word32And(hash, Int32Constant(mask)));
+  // The table grows at runtime, so its mask isn't a constant.
+  SCTableReference mask_ref = stub_cache->mask_reference(StubCache::kPrimary);
+  TNode<Uint32T> mask =
+      Load<Uint32T>(ExternalConstant(ExternalReference::Create(mask_ref)));
+  TNode<UintPtrT> result = ChangeUint32ToWord(Word32And(hash, mask));
   return Signed(result);
 }
 
-TNode<IntPtrT> AccessorAssembler::StubCacheSecondaryOffset(TNode<Name> name,
-                                                           TNode<Map> map) {
+TNode<IntPtrT> AccessorAssembler::StubCacheSecondaryOffset(
+    StubCache* stub_cache, TNode<Name> name, TNode<Map> map) {
   // See v8::internal::StubCache::SecondaryOffset().
 
   // Use the seed from the primary cache in the secondary cache.
@@ -3069,10 +3071,10 @@ TNode<IntPtrT> AccessorAssembler::StubCacheSecondaryOffset(TNode<Name> name,
   TNode<Word32T> hash_a = Int32Add(map32, name32);
   TNode<Word32T> hash_b = Word32Shr(hash_a, StubCache::kSecondaryTableBits);
   TNode<Word32T> hash = Int32Add(hash_a, hash_b);
-  int32_t mask = (StubCache::kSecondaryTableSize - 1)
-                 << StubCache::kCacheIndexShift;
-  TNode<UintPtrT> result =
-      ChangeUint32ToWord(Word32And(hash, Int32Constant(mask)));
+  SCTableReference mask_ref = stub_cache->mask_reference(StubCache::kSecondary);
+  TNode<Uint32T> mask =
+      Load<Uint32T>(ExternalConstant(ExternalReference::Create(mask_ref)));
+  TNode<UintPtrT> result = ChangeUint32ToWord(Word32And(hash, mask));
   return Signed(result);
 }
 
@@ -3087,8 +3089,8 @@ void AccessorAssembler::TryProbeStubCacheTable(
       sizeof(StubCache::Entry) >> StubCache::kCacheIndexShift;
   entry_offset = IntPtrMul(entry_offset, IntPtrConstant(kMultiplier));
 
-  TNode<ExternalReference> key_base = ExternalConstant(
-      ExternalReference::Create(stub_cache->key_reference(table)));
+  TNode<RawPtrT> key_base = Load<RawPtrT>(ExternalConstant(
+      ExternalReference::Create(stub_cache->table_reference(table))));
 
   // Check that the key in the entry matches the name.
   DCHECK_EQ(0, offsetof(StubCache::Entry, key));
@@ -3108,6 +3110,11 @@ void AccessorAssembler::TryProbeStubCacheTable(
                      IntPtrConstant(offsetof(StubCache::Entry, value)))));
 
   // We found the handler.
+  Counters* counters = isolate()->counters();
+  IncrementCounter(table == StubCache::kPrimary
+                       ? counters->megamorphic_stub_cache_primary_hits()
+                       : counters->megamorphic_stub_cache_secondary_hits(),
+                   1);
   *var_handler = handler;
   Goto(if_handler);
 }
@@ -3125,7 +3132,7 @@ void AccessorAssembler::TryProbeStubCache(StubCache* stub_cache,
 
   // Probe the primary table.
   TNode<IntPtrT> primary_offset =
-      StubCachePrimaryOffset(name, lookup_start_object_map);
+      StubCachePrimaryOffset(stub_cache, name, lookup_start_object_map);
   TryProbeStubCacheTable(stub_cache, kPrimary, primary_offset, name,
                          lookup_start_object_map, if_handler, var_handler,
                          &try_secondary);
@@ -3134,7 +3141,7 @@ void AccessorAssembler::TryProbeStubCache(StubCache* stub_cache,
   {
     // Probe the secondary table.
     TNode<IntPtrT> secondary_offset =
-        StubCacheSecondaryOffset(name, lookup_start_object_map);
+        StubCacheSecondaryOffset(stub_cache, name, lookup_start_object_map);
     TryProbeStubCacheTable(stub_cache, kSecondary, secondary_offset, name,
                            lookup_start_object_map, if_handler, var_handler,
                            &miss);
@@ -3147,6 +3154,87 @@ void AccessorAssembler::TryProbeStubCache(StubCache* stub_cache,
   }
 }
 
+//////////////////// Dictionary lookup cache access helpers.
+
+void AccessorAssembler::PropertyDictionaryLookupWithCache(
+    TNode<PropertyDictionary> dictionary, TNode<Name> name, Label* if_found,
+    TVariable<IntPtrT>* var_name_index, Label* if_not_found, LookupMode mode) {
+#ifdef V8_ENABLE_SWISS_NAME_DICTIONARY
+  // SwissNameDictionary lookups already check a group of entries at once.
+  NameDictionaryLookup<PropertyDictionary>(dictionary, name, if_found,
+                                           var_name_index, if_not_found, mode);
+#else
+  using Entry = DictionaryLookupCache::Entry;
+  Comment("PropertyDictionaryLookupWithCache");
+  TNode<ExternalReference> cache =
+      ExternalConstant(ExternalReference::dictionary_lookup_cache(isolate()));
+
+  // See DictionaryLookupCache for the hash function.
+  auto entry_offset = [&](Label* if_hash_not_computed) {
+    TNode<Uint32T> name_hash = LoadNameHash(name, if_hash_not_computed);
+    TNode<Int32T> dictionary32 = TruncateIntPtrToInt32(Signed(
+        WordShr(BitcastTaggedToWord(dictionary), kTaggedSizeLog2)));
+    TNode<Word32T> hash =
+        Word32And(Word32Xor(dictionary32, name_hash),
+                  Int32Constant(DictionaryLookupCache::kLength - 1));
+    return IntPtrMul(Signed(ChangeUint32ToWord(hash)),
+                     IntPtrConstant(sizeof(Entry)));
+  };
+
+  Label lookup(this), found(this, var_name_index);
+  {
+    TNode<IntPtrT> offset = entry_offset(&lookup);
+    TNode<IntPtrT> cached_dictionary = Load<IntPtrT>(
+        cache, IntPtrAdd(offset, IntPtrConstant(offsetof(Entry, dictionary))));
+    GotoIfNot(WordEqual(cached_dictionary, BitcastTaggedToWord(dictionary)),
+              &lookup);
+    TNode<IntPtrT> cached_name = Load<IntPtrT>(
+        cache, IntPtrAdd(offset, IntPtrConstant(offsetof(Entry, name))));
+    GotoIfNot(WordEqual(cached_name, BitcastTaggedToWord(name)), &lookup);
+
+    // The dictionary may have been mutated or rehashed since, or another one
+    // may have taken its place, so check that the entry still holds the name.
+    TNode<IntPtrT> entry = Load<IntPtrT>(
+        cache, IntPtrAdd(offset, IntPtrConstant(offsetof(Entry, entry))));
+    TNode<IntPtrT> capacity =
+        PositiveSmiUntag(GetCapacity<NameDictionary>(dictionary));
+    GotoIfNot(UintPtrLessThan(entry, capacity), &lookup);
+    TNode<IntPtrT> index = EntryToIndex<NameDictionary>(entry);
+    GotoIfNot(TaggedEqual(UnsafeLoadFixedArrayElement(dictionary, index), name),
+              &lookup);
+    *var_name_index = index;
+    Goto(if_found);
+  }
+
+  BIND(&lookup);
+  NameDictionaryLookup<NameDictionary>(dictionary, name, &found, var_name_index,
+                                       if_not_found, mode);
+
+  BIND(&found);
+  {
+    TNode<IntPtrT> offset = entry_offset(if_found);
+    TNode<Int32T> entry = Signed(Uint32Div(
+        TruncateIntPtrToInt32(
+            IntPtrSub(var_name_index->value(),
+                      IntPtrConstant(NameDictionary::kElementsStartIndex))),
+        Uint32Constant(NameDictionary::kEntrySize)));
+    StoreNoWriteBarrier(
+        MachineType::PointerRepresentation(), cache,
+        IntPtrAdd(offset, IntPtrConstant(offsetof(Entry, dictionary))),
+        BitcastTaggedToWord(dictionary));
+    StoreNoWriteBarrier(
+        MachineType::PointerRepresentation(), cache,
+        IntPtrAdd(offset, IntPtrConstant(offsetof(Entry, name))),
+        BitcastTaggedToWord(name));
+    StoreNoWriteBarrier(
+        MachineType::PointerRepresentation(), cache,
+        IntPtrAdd(offset, IntPtrConstant(offsetof(Entry, entry))),
+        ChangeInt32ToIntPtr(entry));
+    Goto(if_found);
+  }
+#endif  // V8_ENABLE_SWISS_NAME_DICTIONARY
+}
+
 //////////////////// Entry points into private implementation (one per stub).
 
 void AccessorAssembler::LoadIC_BytecodeHandler(const LazyLoadICParameters* p,
@@ -969,9 +969,15 @@ void KeyedStoreGenericAssembler::EmitGenericPropertyStore(
 
     // When dealing with class fields defined with DefineKeyedOwnIC or
     // DefineNamedOwnIC, use the slow path to check the existing property.
-    NameDictionaryLookup<PropertyDictionary>(
-        properties, name, IsAnyDefineOwn() ? slow : &dictionary_found,
-        &var_name_index, &not_found, kFindExistingOrInsertionIndex);
+    if (IsAnyDefineOwn()) {
+      NameDictionaryLookup<PropertyDictionary>(properties, name, slow,
+                                               &var_name_index, &not_found,
+                                               kFindExistingOrInsertionIndex);
+    } else {
+      PropertyDictionaryLookupWithCache(properties, name, &dictionary_found,
+                                        &var_name_index, &not_found,
+                                        kFindExistingOrInsertionIndex);
+    }
 
     if (!IsAnyDefineOwn()) {
       BIND(&dictionary_found);
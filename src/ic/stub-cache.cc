@@ -4,6 +4,8 @@
 
 #include "src/ic/stub-cache.h"
 
+#include <memory>
+
 #include "src/ast/ast.h"
 #include "src/base/bits.h"
 #include "src/heap/heap-inl.h"  // For InYoungGeneration().
@@ -18,6 +20,12 @@ StubCache::StubCache(Isolate* isolate) : isolate_(isolate) {
   // Ensure the nullptr (aka Smi::zero()) which StubCache::Get() returns
   // when the entry is not found is not considered as a handler.
   DCHECK(!IC::IsHandler(Tagged<MaybeObject>()));
+  AllocateTables(kPrimaryTableBits);
+}
+
+StubCache::~StubCache() {
+  delete[] primary_;
+  delete[] secondary_;
 }
 
 void StubCache::Initialize() {
@@ -26,10 +34,22 @@ void StubCache::Initialize() {
   Clear();
 }
 
+void StubCache::AllocateTables(int primary_bits) {
+  DCHECK_LE(primary_bits, kMaxPrimaryTableBits);
+  // Keep the ratio of the initial table sizes.
+  int secondary_bits = primary_bits - (kPrimaryTableBits - kSecondaryTableBits);
+  primary_size_ = 1 << primary_bits;
+  secondary_size_ = 1 << secondary_bits;
+  primary_ = new Entry[primary_size_];
+  secondary_ = new Entry[secondary_size_];
+  primary_mask_ = (primary_size_ - 1) << kCacheIndexShift;
+  secondary_mask_ = (secondary_size_ - 1) << kCacheIndexShift;
+}
+
 // Hash algorithm for the primary table. This algorithm is replicated in
 // the AccessorAssembler.  Returns an index into the table that
 // is scaled by 1 << kCacheIndexShift.
-int StubCache::PrimaryOffset(Tagged<Name> name, Tagged<Map> map) {
+int StubCache::PrimaryOffset(Tagged<Name> name, Tagged<Map> map) const {
   // Compute the hash of the name (use entire hash field).
   uint32_t field = name->RawHash();
   DCHECK(Name::IsHashFieldComputed(field));
@@ -40,19 +60,19 @@ int StubCache::PrimaryOffset(Tagged<Name> name, Tagged<Map> map) {
       static_cast<uint32_t>(map.ptr() ^ (map.ptr() >> kPrimaryTableBits));
   // Base the offset on a simple combination of name and map.
   uint32_t key = map_low32bits + field;
-  return key & ((kPrimaryTableSize - 1) << kCacheIndexShift);
+  return key & primary_mask_;
 }
 
 // Hash algorithm for the secondary table.  This algorithm is replicated in
 // assembler. This hash should be sufficiently different from the primary one
 // in order to avoid collisions for minified code with short names.
 // Returns an index into the table that is scaled by 1 << kCacheIndexShift.
-int StubCache::SecondaryOffset(Tagged<Name> name, Tagged<Map> old_map) {
+int StubCache::SecondaryOffset(Tagged<Name> name, Tagged<Map> old_map) const {
   uint32_t name_low32bits = static_cast<uint32_t>(name.ptr());
   uint32_t map_low32bits = static_cast<uint32_t>(old_map.ptr());
   uint32_t key = (map_low32bits + name_low32bits);
   key = key + (key >> kSecondaryTableBits);
-  return key & ((kSecondaryTableSize - 1) << kCacheIndexShift);
+  return key & secondary_mask_;
 }
 
 int StubCache::PrimaryOffsetForTesting(Tagged<Name> name, Tagged<Map> map) {
@@ -80,28 +100,56 @@ bool CommonStubCacheChecks(StubCache* stub_cache, Tagged<Name> name,
 }  // namespace
 #endif
 
+bool StubCache::IsLive(const Entry* entry) {
+  Tagged<MaybeObject> handler(
+      TaggedValue::ToMaybeObject(isolate(), entry->value));
+  // We need SafeEquals here while Builtin Code objects still live in the RO
+  // space inside the sandbox.
+  static_assert(!kAllCodeObjectsLiveInTrustedSpace);
+  return !handler.SafeEquals(isolate()->builtins()->code(Builtin::kIllegal)) &&
+         !entry->map.IsSmi();
+}
+
 void StubCache::Set(Tagged<Name> name, Tagged<Map> map,
                     Tagged<MaybeObject> handler) {
   DCHECK(CommonStubCacheChecks(this, name, map, handler));
 
+  Insert(name, map, handler);
+  updates_++;
+  isolate()->counters()->megamorphic_stub_cache_updates()->Increment();
+
+  // Grow the tables if a large share of the updates in the last round had to
+  // drop a live entry. Generated code doesn't hold on to the tables across
+  // calls into the runtime, so they can be replaced here.
+  if (!v8_flags.stub_cache_resize) return;
+  if (++recent_updates_ < primary_size_) return;
+  static constexpr int kGrowEvictionRatio = 4;
+  if (recent_evictions_ * kGrowEvictionRatio > recent_updates_ &&
+      primary_size_ < (1 << kMaxPrimaryTableBits)) {
+    Grow();
+  }
+  recent_updates_ = 0;
+  recent_evictions_ = 0;
+}
+
+void StubCache::Insert(Tagged<Name> name, Tagged<Map> map,
+                       Tagged<MaybeObject> handler) {
   // Compute the primary entry.
   int primary_offset = PrimaryOffset(name, map);
   Entry* primary = entry(primary_, primary_offset);
-  Tagged<MaybeObject> old_handler(
-      TaggedValue::ToMaybeObject(isolate(), primary->value));
   // If the primary entry has useful data in it, we retire it to the
   // secondary cache before overwriting it.
-  // We need SafeEquals here while Builtin Code objects still live in the RO
-  // space inside the sandbox.
-  static_assert(!kAllCodeObjectsLiveInTrustedSpace);
-  if (!old_handler.SafeEquals(isolate()->builtins()->code(Builtin::kIllegal)) &&
-      !primary->map.IsSmi()) {
+  if (IsLive(primary)) {
     Tagged<Map> old_map =
         Cast<Map>(StrongTaggedValue::ToObject(isolate(), primary->map));
     Tagged<Name> old_name =
         Cast<Name>(StrongTaggedValue::ToObject(isolate(), primary->key));
     int secondary_offset = SecondaryOffset(old_name, old_map);
     Entry* secondary = entry(secondary_, secondary_offset);
+    if (IsLive(secondary)) {
+      evictions_++;
+      recent_evictions_++;
+    }
     *secondary = *primary;
   }
 
@@ -109,7 +157,29 @@ void StubCache::Set(Tagged<Name> name, Tagged<Map> map,
   primary->key = StrongTaggedValue(name);
   primary->value = TaggedValue(handler);
   primary->map = StrongTaggedValue(map);
-  isolate()->counters()->megamorphic_stub_cache_updates()->Increment();
+}
+
+void StubCache::Grow() {
+  std::unique_ptr<Entry[]> old_primary(primary_);
+  std::unique_ptr<Entry[]> old_secondary(secondary_);
+  int old_primary_size = primary_size_;
+  int old_secondary_size = secondary_size_;
+  size_t evictions = evictions_;
+  AllocateTables(base::bits::WhichPowerOfTwo(old_primary_size) + 1);
+  ClearTables();
+
+  // Move the older secondary entries first, so that primary entries win
+  // where they collide.
+  auto move = [this](const Entry& entry) {
+    if (!IsLive(&entry)) return;
+    Insert(Cast<Name>(StrongTaggedValue::ToObject(isolate(), entry.key)),
+           Cast<Map>(StrongTaggedValue::ToObject(isolate(), entry.map)),
+           TaggedValue::ToMaybeObject(isolate(), entry.value));
+  };
+  for (int i = 0; i < old_secondary_size; i++) move(old_secondary[i]);
+  for (int i = 0; i < old_primary_size; i++) move(old_primary[i]);
+  evictions_ = evictions;
+  resizes_++;
 }
 
 Tagged<MaybeObject> StubCache::Get(Tagged<Name> name, Tagged<Map> map) {
@@ -128,14 +198,22 @@ Tagged<MaybeObject> StubCache::Get(Tagged<Name> name, Tagged<Map> map) {
 }
 
 void StubCache::Clear() {
+  // The tables keep their size, since the workload that made them grow
+  // usually continues after the GC.
+  ClearTables();
+  recent_updates_ = 0;
+  recent_evictions_ = 0;
+}
+
+void StubCache::ClearTables() {
   Tagged<MaybeObject> empty = isolate_->builtins()->code(Builtin::kIllegal);
   Tagged<Name> empty_string = ReadOnlyRoots(isolate()).empty_string();
-  for (int i = 0; i < kPrimaryTableSize; i++) {
+  for (int i = 0; i < primary_size_; i++) {
     primary_[i].key = StrongTaggedValue(empty_string);
     primary_[i].map = StrongTaggedValue(Smi::zero());
     primary_[i].value = TaggedValue(empty);
   }
-  for (int j = 0; j < kSecondaryTableSize; j++) {
+  for (int j = 0; j < secondary_size_; j++) {
     secondary_[j].key = StrongTaggedValue(empty_string);
     secondary_[j].map = StrongTaggedValue(Smi::zero());
     secondary_[j].value = TaggedValue(empty);
@@ -51,19 +51,26 @@ class V8_EXPORT_PRIVATE StubCache {
 
   enum Table { kPrimary, kSecondary };
 
-  SCTableReference key_reference(StubCache::Table table) {
-    return SCTableReference(
-        reinterpret_cast<Address>(&first_entry(table)->key));
-  }
-
-  SCTableReference map_reference(StubCache::Table table) {
-    return SCTableReference(
-        reinterpret_cast<Address>(&first_entry(table)->map));
+  // The tables are reallocated when the cache grows, so generated code loads
+  // their current address and offset mask from the cache itself.
+  SCTableReference table_reference(StubCache::Table table) {
+    switch (table) {
+      case StubCache::kPrimary:
+        return SCTableReference(reinterpret_cast<Address>(&primary_));
+      case StubCache::kSecondary:
+        return SCTableReference(reinterpret_cast<Address>(&secondary_));
+    }
+    UNREACHABLE();
   }
 
-  SCTableReference value_reference(StubCache::Table table) {
-    return SCTableReference(
-        reinterpret_cast<Address>(&first_entry(table)->value));
+  SCTableReference mask_reference(StubCache::Table table) {
+    switch (table) {
+      case StubCache::kPrimary:
+        return SCTableReference(reinterpret_cast<Address>(&primary_mask_));
+      case StubCache::kSecondary:
+        return SCTableReference(reinterpret_cast<Address>(&secondary_mask_));
+    }
+    UNREACHABLE();
   }
 
   StubCache::Entry* first_entry(StubCache::Table table) {
@@ -85,16 +92,31 @@ class V8_EXPORT_PRIVATE StubCache {
   // the static_assert below, in {entry(...)}).
   static const int kCacheIndexShift = Name::HashBits::kShift;
 
+  // The initial table sizes. The tables grow together, up to
+  // kMaxPrimaryTableBits, when the cache keeps evicting live entries.
   static const int kPrimaryTableBits = 11;
   static const int kPrimaryTableSize = (1 << kPrimaryTableBits);
   static const int kSecondaryTableBits = 9;
   static const int kSecondaryTableSize = (1 << kSecondaryTableBits);
+  static const int kMaxPrimaryTableBits = 14;
 
-  static int PrimaryOffsetForTesting(Tagged<Name> name, Tagged<Map> map);
-  static int SecondaryOffsetForTesting(Tagged<Name> name, Tagged<Map> map);
+  int primary_table_size() const { return primary_size_; }
+  int secondary_table_size() const { return secondary_size_; }
+
+  // Number of handlers installed by the runtime, i.e. misses in generated
+  // code that were resolved.
+  size_t updates() const { return updates_; }
+  // Number of live entries that were dropped from the secondary table.
+  size_t evictions() const { return evictions_; }
+  // Number of times the tables grew.
+  size_t resizes() const { return resizes_; }
+
+  int PrimaryOffsetForTesting(Tagged<Name> name, Tagged<Map> map);
+  int SecondaryOffsetForTesting(Tagged<Name> name, Tagged<Map> map);
 
   // The constructor is made public only for the purposes of testing.
   explicit StubCache(Isolate* isolate);
+  ~StubCache();
   StubCache(const StubCache&) = delete;
   StubCache& operator=(const StubCache&) = delete;
 
@@ -109,12 +131,12 @@ class V8_EXPORT_PRIVATE StubCache {
   // Hash algorithm for the primary table.  This algorithm is replicated in
   // assembler for every architecture.  Returns an index into the table that
   // is scaled by 1 << kCacheIndexShift.
-  static int PrimaryOffset(Tagged<Name> name, Tagged<Map> map);
+  int PrimaryOffset(Tagged<Name> name, Tagged<Map> map) const;
 
   // Hash algorithm for the secondary table.  This algorithm is replicated in
   // assembler for every architecture.  Returns an index into the table that
   // is scaled by 1 << kCacheIndexShift.
-  static int SecondaryOffset(Tagged<Name> name, Tagged<Map> map);
+  int SecondaryOffset(Tagged<Name> name, Tagged<Map> map) const;
 
   // Compute the entry for a given offset in exactly the same way as
   // we do in generated code.  We generate an hash code that already
@@ -130,9 +152,31 @@ class V8_EXPORT_PRIVATE StubCache {
                                     offset * multiplier);
   }
 
- private:
-  Entry primary_[kPrimaryTableSize];
-  Entry secondary_[kSecondaryTableSize];
+  // Allocates uninitialized tables with 1 << primary_bits primary entries,
+  // without freeing the current ones.
+  void AllocateTables(int primary_bits);
+  void ClearTables();
+  // Moves the cache to tables twice the size, keeping the live entries.
+  void Grow();
+  // Stores an entry, retiring the old primary entry to the secondary table.
+  void Insert(Tagged<Name> name, Tagged<Map> map, Tagged<MaybeObject> handler);
+  bool IsLive(const Entry* entry);
+
+  // Read by generated code, see {table_reference} and {mask_reference}.
+  Entry* primary_ = nullptr;
+  Entry* secondary_ = nullptr;
+  uint32_t primary_mask_ = 0;
+  uint32_t secondary_mask_ = 0;
+
+  int primary_size_ = 0;
+  int secondary_size_ = 0;
+  // Updates and evictions since the tables were last cleared or resized,
+  // which decide whether to grow.
+  int recent_updates_ = 0;
+  int recent_evictions_ = 0;
+  size_t updates_ = 0;
+  size_t evictions_ = 0;
+  size_t resizes_ = 0;
   Isolate* isolate_;
 
   friend class Isolate;
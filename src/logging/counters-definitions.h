@@ -365,6 +365,8 @@ namespace internal {
   SC(maps_created, V8.MapsCreated)                                             \
   SC(megamorphic_stub_cache_updates, V8.MegamorphicStubCacheUpdates)           \
   SC(regexp_entry_runtime, V8.RegExpEntryRuntime)                              \
+  SC(regexp_global_cache_hits, V8.RegExpGlobalCacheHits)                       \
+  SC(regexp_global_cache_misses, V8.RegExpGlobalCacheMisses)                   \
   SC(stack_interrupts, V8.StackInterrupts)                                     \
   SC(new_space_bytes_available, V8.MemoryNewSpaceBytesAvailable)               \
   SC(new_space_bytes_committed, V8.MemoryNewSpaceBytesCommitted)               \
@@ -385,15 +387,20 @@ namespace internal {
   SC(wasm_reloc_size, V8.WasmRelocBytes)                                       \
   SC(wasm_deopt_data_size, V8.WasmDeoptDataBytes)                              \
   SC(wasm_lazily_compiled_functions, V8.WasmLazilyCompiledFunctions)           \
+  SC(wasm_lazily_deserialized_functions, V8.WasmLazilyDeserializedFunctions)   \
+  SC(wasm_sampled_tier_ups, V8.WasmSampledTierUps)                             \
   SC(wasm_compiled_export_wrapper, V8.WasmCompiledExportWrappers)
 
 // List of counters that can be incremented from generated code. We need them in
 // a separate list to be able to relocate them.
-#define STATS_COUNTER_NATIVE_CODE_LIST(SC)                         \
-  /* Number of write barriers executed at runtime. */              \
-  SC(write_barriers, V8.WriteBarriers)                             \
-  SC(regexp_entry_native, V8.RegExpEntryNative)                    \
-  SC(megamorphic_stub_cache_probes, V8.MegamorphicStubCacheProbes) \
+#define STATS_COUNTER_NATIVE_CODE_LIST(SC)                                     \
+  /* Number of write barriers executed at runtime. */                          \
+  SC(write_barriers, V8.WriteBarriers)                                         \
+  SC(regexp_entry_native, V8.RegExpEntryNative)                                \
+  SC(megamorphic_stub_cache_probes, V8.MegamorphicStubCacheProbes)             \
+  SC(megamorphic_stub_cache_primary_hits, V8.MegamorphicStubCachePrimaryHits)  \
+  SC(megamorphic_stub_cache_secondary_hits,                                    \
+     V8.MegamorphicStubCacheSecondaryHits)                                     \
   SC(megamorphic_stub_cache_misses, V8.MegamorphicStubCacheMisses)
 
 }  // namespace internal
@@ -429,6 +429,7 @@ class RuntimeCallTimer final {
   ADD_THREAD_SPECIFIC_COUNTER(V, Parse, FunctionLiteral)                      \
   ADD_THREAD_SPECIFIC_COUNTER(V, Parse, Program)                              \
   ADD_THREAD_SPECIFIC_COUNTER(V, PreParse, ArrowFunctionLiteral)              \
+  ADD_THREAD_SPECIFIC_COUNTER(V, PreParse, NoVariableResolution)              \
   ADD_THREAD_SPECIFIC_COUNTER(V, PreParse, WithVariableResolution)
 
 #define FOR_EACH_MANUAL_COUNTER(V)             \
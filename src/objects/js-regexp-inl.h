@@ -8,6 +8,7 @@
 #include "src/objects/js-regexp.h"
 
 #include "src/objects/js-array-inl.h"
+#include "src/objects/managed.h"
 #include "src/objects/objects-inl.h"  // Needed for write barriers
 #include "src/objects/smi.h"
 #include "src/objects/string.h"
@@ -153,6 +154,13 @@ SMI_ACCESSORS(IrRegExpData, max_register_count, kMaxRegisterCountOffset)
 SMI_ACCESSORS(IrRegExpData, capture_count, kCaptureCountOffset)
 SMI_ACCESSORS(IrRegExpData, ticks_until_tier_up, kTicksUntilTierUpOffset)
 SMI_ACCESSORS(IrRegExpData, backtrack_limit, kBacktrackLimitOffset)
+ACCESSORS(IrRegExpData, required_literal, Tagged<Object>,
+          kRequiredLiteralOffset)
+SMI_ACCESSORS(IrRegExpData, required_literal_max_offset,
+              kRequiredLiteralMaxOffsetOffset)
+PROTECTED_POINTER_ACCESSORS(IrRegExpData, experimental_lazy_dfa,
+                            TrustedManaged<ExperimentalRegExpLazyDfa>,
+                            kExperimentalLazyDfaOffset)
 
 }  // namespace internal
 }  // namespace v8
@@ -417,6 +417,7 @@ void IrRegExpData::DiscardCompiledCodeForSerialization() {
   clear_uc16_code();
   clear_latin1_bytecode();
   clear_uc16_bytecode();
+  clear_experimental_lazy_dfa();
 }
 
 void IrRegExpData::SetBytecodeForExperimental(
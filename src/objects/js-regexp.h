@@ -19,6 +19,9 @@
 namespace v8::internal {
 
 class RegExpData;
+class ExperimentalRegExpLazyDfa;
+template <typename CppType>
+class TrustedManaged;
 
 #include "torque-generated/src/objects/js-regexp-tq.inc"
 
@@ -258,6 +261,18 @@ class IrRegExpData : public RegExpData {
   DECL_INT_ACCESSORS(capture_count)
   DECL_INT_ACCESSORS(ticks_until_tier_up)
   DECL_INT_ACCESSORS(backtrack_limit)
+  // A literal that every match of the regexp contains, or Smi::zero() if
+  // there is none or searching for it can't skip any input, or
+  // kUninitializedValue before the first compilation.
+  DECL_ACCESSORS(required_literal, Tagged<Object>)
+  // Upper bound on the distance between the start of a match and the
+  // required literal. Only valid if there is a required literal.
+  DECL_INT_ACCESSORS(required_literal_max_offset)
+  // The lazy DFA that checks for a match before the experimental engine runs,
+  // if the regexp is compiled for it or has fallen back to it after excessive
+  // backtracking, and the DFA can run its bytecode.
+  DECL_PROTECTED_POINTER_ACCESSORS(experimental_lazy_dfa,
+                                   TrustedManaged<ExperimentalRegExpLazyDfa>)
 
   bool CanTierUp();
   bool MarkedForTierUp();
@@ -276,17 +291,20 @@ class IrRegExpData : public RegExpData {
   DECL_PRINTER(IrRegExpData)
   DECL_VERIFIER(IrRegExpData)
 
-#define FIELD_LIST(V)                             \
-  V(kLatin1BytecodeOffset, kProtectedPointerSize) \
-  V(kUc16BytecodeOffset, kProtectedPointerSize)   \
-  V(kLatin1CodeOffset, kCodePointerSize)          \
-  V(kUc16CodeOffset, kCodePointerSize)            \
-  V(kCaptureNameMapOffset, kTaggedSize)           \
-  V(kMaxRegisterCountOffset, kTaggedSize)         \
-  V(kCaptureCountOffset, kTaggedSize)             \
-  V(kTicksUntilTierUpOffset, kTaggedSize)         \
-  V(kBacktrackLimitOffset, kTaggedSize)           \
-  V(kHeaderSize, 0)                               \
+#define FIELD_LIST(V)                                  \
+  V(kLatin1BytecodeOffset, kProtectedPointerSize)      \
+  V(kUc16BytecodeOffset, kProtectedPointerSize)        \
+  V(kLatin1CodeOffset, kCodePointerSize)               \
+  V(kUc16CodeOffset, kCodePointerSize)                 \
+  V(kCaptureNameMapOffset, kTaggedSize)                \
+  V(kMaxRegisterCountOffset, kTaggedSize)              \
+  V(kCaptureCountOffset, kTaggedSize)                  \
+  V(kTicksUntilTierUpOffset, kTaggedSize)              \
+  V(kBacktrackLimitOffset, kTaggedSize)                \
+  V(kRequiredLiteralOffset, kTaggedSize)               \
+  V(kRequiredLiteralMaxOffsetOffset, kTaggedSize)      \
+  V(kExperimentalLazyDfaOffset, kProtectedPointerSize) \
+  V(kHeaderSize, 0)                                    \
   V(kSize, 0)
 
   DEFINE_FIELD_OFFSET_CONSTANTS(RegExpData::kHeaderSize, FIELD_LIST)
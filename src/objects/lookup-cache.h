@@ -55,6 +55,41 @@ class DescriptorLookupCache {
   friend class Isolate;
 };
 
+// Cache for mapping (dictionary, property name) into the entry of the name in
+// a NameDictionary of a dictionary-mode object. It is filled and probed by
+// the property access paths of generated code, see
+// AccessorAssembler::PropertyDictionaryLookupWithCache(). Entries are only
+// hints: the dictionary may have been mutated, rehashed or moved since, so
+// generated code checks that the entry still holds the name before using it.
+// Cleared at startup and prior to mark-compact.
+class DictionaryLookupCache {
+ public:
+  DictionaryLookupCache(const DictionaryLookupCache&) = delete;
+  DictionaryLookupCache& operator=(const DictionaryLookupCache&) = delete;
+
+  struct Entry {
+    Address dictionary;
+    Address name;
+    intptr_t entry;
+  };
+
+  // The index of the entry for (dictionary, name) is
+  // ((dictionary address >> kTaggedSizeLog2) ^ name hash) & (kLength - 1).
+  static const int kLength = 256;
+
+  // Clear the cache.
+  void Clear();
+
+  Address address() { return reinterpret_cast<Address>(entries_); }
+
+ private:
+  DictionaryLookupCache() { Clear(); }
+
+  Entry entries_[kLength];
+
+  friend class Isolate;
+};
+
 }  // namespace internal
 }  // namespace v8
 
@@ -6,6 +6,7 @@
 #define V8_OBJECTS_MANAGED_INL_H_
 
 #include "src/handles/global-handles-inl.h"
+#include "src/heap/heap-inl.h"
 #include "src/objects/managed.h"
 
 namespace v8::internal {
@@ -66,6 +67,17 @@ Handle<TrustedManaged<CppType>> TrustedManaged<CppType>::From(
   return handle;
 }
 
+template <class CppType>
+void TrustedManaged<CppType>::UpdateEstimatedSize(Isolate* isolate,
+                                                  size_t estimated_size) {
+  ManagedPtrDestructor* destructor = GetDestructor();
+  if (destructor->estimated_size_ == estimated_size) return;
+  isolate->heap()->update_external_memory(
+      static_cast<int64_t>(estimated_size) -
+      static_cast<int64_t>(destructor->estimated_size_));
+  destructor->estimated_size_ = estimated_size;
+}
+
 }  // namespace v8::internal
 
 #endif  // V8_OBJECTS_MANAGED_INL_H_
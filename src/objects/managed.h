@@ -154,22 +154,32 @@ class TrustedManaged : public TrustedForeign {
   // Get a reference to the shared pointer to the C++ object.
   V8_INLINE const std::shared_ptr<CppType>& get() { return *GetSharedPtrPtr(); }
 
+  // Read back the current memory estimate.
+  size_t estimated_size() const { return GetDestructor()->estimated_size_; }
+
   // Create a {Managed<CppType>} from an existing {std::shared_ptr} or
   // {std::unique_ptr} (which will implicitly convert to {std::shared_ptr}).
   static Handle<TrustedManaged<CppType>> From(
       Isolate* isolate, size_t estimated_size,
       std::shared_ptr<CppType> shared_ptr);
 
+  // Replaces the memory estimate, for C++ objects that grow or shrink after
+  // creation. Only updates the heap's external memory counter, which the GC
+  // takes into account at its next limit check, so this never triggers a GC.
+  inline void UpdateEstimatedSize(Isolate* isolate, size_t estimated_size);
+
  private:
   friend class Tagged<TrustedManaged>;
 
-  // Internally the {TrustedForeign} stores a pointer to the
-  // {std::shared_ptr<CppType>}.
+  // Internally the {TrustedForeign} stores a pointer to a
+  // {ManagedPtrDestructor}, which again stores the {std::shared_ptr<CppType>}.
+  ManagedPtrDestructor* GetDestructor() const {
+    return reinterpret_cast<ManagedPtrDestructor*>(foreign_address());
+  }
+
   std::shared_ptr<CppType>* GetSharedPtrPtr() {
-    auto destructor =
-        reinterpret_cast<ManagedPtrDestructor*>(foreign_address());
     return reinterpret_cast<std::shared_ptr<CppType>*>(
-        destructor->shared_ptr_ptr_);
+        GetDestructor()->shared_ptr_ptr_);
   }
 };
 
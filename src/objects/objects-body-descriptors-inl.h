@@ -424,6 +424,8 @@ class IrRegExpData::BodyDescriptor final : public BodyDescriptorBase {
     IterateProtectedPointer(obj, kLatin1BytecodeOffset, v);
     IterateProtectedPointer(obj, kUc16BytecodeOffset, v);
     IteratePointer(obj, kCaptureNameMapOffset, v);
+    IteratePointer(obj, kRequiredLiteralOffset, v);
+    IterateProtectedPointer(obj, kExperimentalLazyDfaOffset, v);
   }
 
   static inline int SizeOf(Tagged<Map> map, Tagged<HeapObject> obj) {
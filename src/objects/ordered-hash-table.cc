@@ -278,6 +278,9 @@ MaybeHandle<Derived> OrderedHashTable<Derived, entrysize>::Rehash(
   int removed_holes_index = 0;
 
   DisallowGarbageCollection no_gc;
+  // The new table was just allocated, so copying large young tables into it
+  // doesn't need write barriers.
+  WriteBarrierMode mode = new_table->GetWriteBarrierMode(no_gc);
 
   for (InternalIndex old_entry : table->IterateEntries()) {
     int old_entry_raw = old_entry.as_int();
@@ -295,7 +298,7 @@ MaybeHandle<Derived> OrderedHashTable<Derived, entrysize>::Rehash(
     int old_index = table->EntryToIndexRaw(old_entry_raw);
     for (int i = 0; i < entrysize; ++i) {
       Tagged<Object> value = table->get(old_index + i);
-      new_table->set(new_index + i, value);
+      new_table->set(new_index + i, value, mode);
     }
     new_table->set(new_index + kChainOffset, chain_entry);
     ++new_entry;
@@ -1113,6 +1113,54 @@ bool SharedFunctionInfo::CanDiscardCompiled() const {
          HasBaselineCode();
 }
 
+bool SharedFunctionInfo::HasBytecodeArrayForFlushing(
+    IsolateForSandbox isolate,
+    base::EnumSet<CodeFlushMode> code_flush_mode) const {
+  if (IsFlushingDisabled(code_flush_mode)) return false;
+
+  // TODO(rmcilroy): Enable bytecode flushing for resumable functions.
+  if (IsResumableFunction(kind()) || !allows_lazy_compilation()) {
+    return false;
+  }
+
+  // Get a snapshot of the function data field, and if it is a bytecode array,
+  // check if it is old. Note, this is done this way since this function can be
+  // called by the concurrent marker.
+  Tagged<Object> data = GetTrustedData(isolate);
+  if (IsCode(data)) {
+    Tagged<Code> baseline_code = Cast<Code>(data);
+    DCHECK_EQ(baseline_code->kind(), CodeKind::BASELINE);
+    // If baseline code flushing isn't enabled and we have baseline data on SFI
+    // we cannot flush baseline / bytecode.
+    if (!IsBaselineCodeFlushingEnabled(code_flush_mode)) return false;
+    data = baseline_code->bytecode_or_interpreter_data();
+  } else if (!IsByteCodeFlushingEnabled(code_flush_mode)) {
+    // If bytecode flushing isn't enabled and there is no baseline code there is
+    // nothing to flush.
+    return false;
+  }
+
+  return IsBytecodeArray(data);
+}
+
+bool SharedFunctionInfo::HasOldBytecode(bool isolate_in_background) const {
+  if (v8_flags.flush_code_based_on_time) {
+    return age() >= v8_flags.bytecode_old_time;
+  } else if (v8_flags.flush_code_based_on_tab_visibility) {
+    return isolate_in_background || V8_UNLIKELY(age() == kMaxAge);
+  } else {
+    return age() >= v8_flags.bytecode_old_age;
+  }
+}
+
+bool SharedFunctionInfo::ShouldFlushCode(
+    IsolateForSandbox isolate, base::EnumSet<CodeFlushMode> code_flush_mode,
+    bool isolate_in_background) const {
+  return HasBytecodeArrayForFlushing(isolate, code_flush_mode) &&
+         (IsStressFlushingEnabled(code_flush_mode) ||
+          HasOldBytecode(isolate_in_background));
+}
+
 bool SharedFunctionInfo::is_class_constructor() const {
   return IsClassConstructorBit::decode(flags(kRelaxedLoad));
 }
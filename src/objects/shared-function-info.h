@@ -650,10 +650,20 @@ class SharedFunctionInfo
                                       ObjectSlot slot,
                                       Tagged<HeapObject> target) {});
 
-  // Returns true if the function has old bytecode that could be flushed. This
-  // function shouldn't access any flags as it is used by concurrent marker.
-  // Hence it takes the mode as an argument.
-  inline bool ShouldFlushCode(base::EnumSet<CodeFlushMode> code_flush_mode);
+  // Returns true if the function has bytecode, possibly behind baseline code,
+  // that the GC may flush under |code_flush_mode|. This is called by the
+  // concurrent marker, hence the mode is passed in rather than computed.
+  inline bool HasBytecodeArrayForFlushing(
+      IsolateForSandbox isolate,
+      base::EnumSet<CodeFlushMode> code_flush_mode) const;
+
+  // Returns true if the bytecode has aged enough for the GC to flush it.
+  inline bool HasOldBytecode(bool isolate_in_background) const;
+
+  // Returns true if the function has old bytecode that the GC would flush.
+  inline bool ShouldFlushCode(IsolateForSandbox isolate,
+                              base::EnumSet<CodeFlushMode> code_flush_mode,
+                              bool isolate_in_background) const;
 
   enum Inlineability {
     // Different reasons for not being inlineable:
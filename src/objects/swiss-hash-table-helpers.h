@@ -40,6 +40,15 @@
 #error "Bad configuration!"
 #endif
 
+// NEON on 64-bit ARM hosts, which also provides horizontal adds.
+#ifndef V8_SWISS_TABLE_HAVE_NEON_HOST
+#if defined(__ARM_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+#define V8_SWISS_TABLE_HAVE_NEON_HOST 1
+#else
+#define V8_SWISS_TABLE_HAVE_NEON_HOST 0
+#endif
+#endif
+
 // Unlike Abseil, we cannot select SSE purely by host capabilities. When
 // creating a snapshot, the group width must be compatible. The SSE
 // implementation uses a group width of 16, whereas the non-SSE version uses 8.
@@ -56,6 +65,16 @@
 #endif
 #endif
 
+// arm64 always has NEON. It uses the same group width as SSE2 targets, and
+// generated code uses the same SIMD operations on both.
+#ifndef V8_SWISS_TABLE_HAVE_NEON_TARGET
+#if V8_TARGET_ARCH_ARM64
+#define V8_SWISS_TABLE_HAVE_NEON_TARGET 1
+#else
+#define V8_SWISS_TABLE_HAVE_NEON_TARGET 0
+#endif
+#endif
+
 #if V8_SWISS_TABLE_HAVE_SSE2_HOST
 #include <emmintrin.h>
 #endif
@@ -64,6 +83,10 @@
 #include <tmmintrin.h>
 #endif
 
+#if V8_SWISS_TABLE_HAVE_NEON_HOST
+#include <arm_neon.h>
+#endif
+
 namespace v8 {
 namespace internal {
 namespace swiss_table {
@@ -248,6 +271,42 @@ struct GroupSse2Impl {
 };
 #endif  // V8_SWISS_TABLE_HAVE_SSE2_HOST
 
+#if V8_SWISS_TABLE_HAVE_NEON_HOST
+// Counterpart to GroupSse2Impl on NEON hosts, with the same group width and
+// bitmasks.
+struct GroupNeonImpl {
+  static constexpr size_t kWidth = 16;  // the number of slots per group
+
+  explicit GroupNeonImpl(const ctrl_t* pos)
+      : ctrl(vld1q_s8(reinterpret_cast<const int8_t*>(pos))) {}
+
+  // Returns a bitmask representing the positions of slots that match |hash|.
+  BitMask<uint32_t, kWidth> Match(h2_t hash) const {
+    auto match = vdupq_n_s8(static_cast<int8_t>(hash));
+    return BitMask<uint32_t, kWidth>(MoveMask(vceqq_s8(match, ctrl)));
+  }
+
+  // Returns a bitmask representing the positions of empty slots.
+  BitMask<uint32_t, kWidth> MatchEmpty() const {
+    return Match(static_cast<h2_t>(kEmpty));
+  }
+
+  int8x16_t ctrl;
+
+ private:
+  // NEON has no counterpart of _mm_movemask_epi8. Instead, each all-ones or
+  // all-zeros lane keeps only its bit within its half of the mask, and the
+  // lanes of each half are added up.
+  static uint32_t MoveMask(uint8x16_t lanes) {
+    static constexpr uint8_t kLaneBits[kWidth] = {
+        1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+    uint8x16_t bits = vandq_u8(lanes, vld1q_u8(kLaneBits));
+    return static_cast<uint32_t>(vaddv_u8(vget_low_u8(bits))) |
+           (static_cast<uint32_t>(vaddv_u8(vget_high_u8(bits))) << 8);
+  }
+};
+#endif  // V8_SWISS_TABLE_HAVE_NEON_HOST
+
 // A portable, inefficient version of GroupSse2Impl. This exists so SSE2-less
 // hosts can generate snapshots for SSE2-capable targets.
 struct GroupSse2Polyfill {
@@ -339,12 +398,14 @@ struct GroupPortableImpl {
 // backend should only use SSE2 when compiling the SIMD version of
 // SwissNameDictionary into the builtin.
 using Group = GroupPortableImpl;
-#elif V8_SWISS_TABLE_HAVE_SSE2_TARGET
+#elif V8_SWISS_TABLE_HAVE_SSE2_TARGET || V8_SWISS_TABLE_HAVE_NEON_TARGET
 // Use a matching group size between host and target.
 #if V8_SWISS_TABLE_HAVE_SSE2_HOST
 using Group = GroupSse2Impl;
+#elif V8_SWISS_TABLE_HAVE_NEON_HOST
+using Group = GroupNeonImpl;
 #else
-#if V8_HOST_ARCH_IA32 || V8_HOST_ARCH_X64
+#if (V8_HOST_ARCH_IA32 || V8_HOST_ARCH_X64) && V8_SWISS_TABLE_HAVE_SSE2_TARGET
 // If we do not detect SSE2 when building for the ia32/x64 target, the
 // V8_SWISS_TABLE_HAVE_SSE2_TARGET logic will incorrectly cause the final output
 // to use the inefficient polyfill implementation. Detect this case and warn if
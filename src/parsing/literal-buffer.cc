@@ -65,6 +65,19 @@ void LiteralBuffer::ConvertToTwoByte() {
   is_one_byte_ = false;
 }
 
+void LiteralBuffer::AddAsciiChars(base::Vector<const uint16_t> chars) {
+  if (chars.empty()) return;
+  int length = static_cast<int>(chars.length());
+  int byte_length = is_one_byte() ? length : length * base::kUC16Size;
+  while (position_ + byte_length > backing_store_.length()) ExpandBuffer();
+  if (is_one_byte()) {
+    CopyChars(backing_store_.begin() + position_, chars.begin(), length);
+  } else {
+    MemCopy(backing_store_.begin() + position_, chars.begin(), byte_length);
+  }
+  position_ += byte_length;
+}
+
 void LiteralBuffer::AddTwoByteChar(base::uc32 code_unit) {
   DCHECK(!is_one_byte());
   if (position_ >= backing_store_.length()) ExpandBuffer();
@@ -38,6 +38,9 @@ class LiteralBuffer final {
     AddTwoByteChar(code_unit);
   }
 
+  // Appends a run of ASCII code units in one step.
+  void AddAsciiChars(base::Vector<const uint16_t> chars);
+
   bool is_one_byte() const { return is_one_byte_; }
 
   bool Equals(base::Vector<const char> keyword) const {
@@ -61,6 +61,7 @@ class Zone;
   V(allow_lazy_compile, bool, 1, _)                             \
   V(post_parallel_compile_tasks_for_eager_toplevel, bool, 1, _) \
   V(post_parallel_compile_tasks_for_lazy, bool, 1, _)           \
+  V(post_parallel_compile_tasks_for_lazy_toplevel, bool, 1, _)  \
   V(collect_source_positions, bool, 1, _)                       \
   V(is_repl_mode, bool, 1, _)                                   \
   V(produce_compile_hints, bool, 1, _)                          \
@@ -2855,7 +2855,9 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
       can_post_parallel_task && !flags().is_reparse() &&
       ((is_eager_top_level_function &&
         flags().post_parallel_compile_tasks_for_eager_toplevel()) ||
-       (is_lazy && flags().post_parallel_compile_tasks_for_lazy()));
+       (is_lazy && flags().post_parallel_compile_tasks_for_lazy()) ||
+       (is_lazy && is_top_level &&
+        flags().post_parallel_compile_tasks_for_lazy_toplevel()));
 
   // Determine whether we should lazy parse the inner function. This will be
   // when either the function is lazy by inspection, or when we force it to be
@@ -2929,11 +2931,21 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
   if (did_preparse_successfully && runtime_call_stats_ &&
       V8_UNLIKELY(TracingFlags::is_runtime_stats_enabled())) {
     runtime_call_stats_->CorrectCurrentCounterId(
-        RuntimeCallCounterId::kPreParseWithVariableResolution,
+        is_top_level ? RuntimeCallCounterId::kPreParseNoVariableResolution
+                     : RuntimeCallCounterId::kPreParseWithVariableResolution,
         RuntimeCallStats::kThreadSpecific);
   }
 #endif  // V8_RUNTIME_CALL_STATS
 
+  // Small lazy functions are cheaper to compile on the main thread on first
+  // call than to parse a second time on a background thread, so only post
+  // parallel tasks for functions above the size threshold.
+  if (should_post_parallel_task && is_lazy &&
+      scope->end_position() - scope->start_position() <
+          v8_flags.parallel_compile_tasks_min_function_size) {
+    should_post_parallel_task = false;
+  }
+
   // Validate function name. We can do this only after parsing the function,
   // since the function can declare itself strict.
   language_mode = scope->language_mode();
@@ -619,6 +619,17 @@ bool Utf8ExternalStreamingStream::SkipToPosition(size_t position) {
   }
 
   while (cursor < end && chars < position) {
+    // Fast path for ascii sequences, where each byte is one char.
+    if (state == unibrow::Utf8::State::kAccept) {
+      size_t max_length = std::min({static_cast<size_t>(end - cursor),
+                                    position - chars,
+                                    static_cast<size_t>(kMaxInt)});
+      int ascii_length = NonAsciiStart(cursor, static_cast<int>(max_length));
+      cursor += ascii_length;
+      chars += ascii_length;
+      if (cursor == end || chars == position) break;
+    }
+
     unibrow::uchar t =
         unibrow::Utf8::ValueOfIncremental(&cursor, &state, &incomplete_char);
     if (t != unibrow::Utf8::kIncomplete) {
@@ -710,8 +721,7 @@ void Utf8ExternalStreamingStream::FillBufferFromCurrentChunk() {
     size_t max_buffer = max_buffer_end - output_cursor;
     int max_length = static_cast<int>(std::min(remaining, max_buffer));
     DCHECK_EQ(state, unibrow::Utf8::State::kAccept);
-    int ascii_length = NonAsciiStart(cursor, max_length);
-    CopyChars(output_cursor, cursor, ascii_length);
+    int ascii_length = CopyAsciiChars(output_cursor, cursor, max_length);
     cursor += ascii_length;
     output_cursor += ascii_length;
   }
@@ -195,9 +195,8 @@ enum class ScanFlags : uint8_t {
   // multiple characters.
   kCannotBeKeyword = 1 << 1,
   kCannotBeKeywordStart = 1 << 2,
-  kStringTerminator = 1 << 3,
-  kIdentifierNeedsSlowPath = 1 << 4,
-  kMultilineCommentCharacterNeedsSlowPath = 1 << 5,
+  kIdentifierNeedsSlowPath = 1 << 3,
+  kMultilineCommentCharacterNeedsSlowPath = 1 << 4,
 };
 constexpr uint8_t GetScanFlags(char c) {
   return
@@ -216,10 +215,6 @@ constexpr uint8_t GetScanFlags(char c) {
       (!IsAsciiIdentifier(c)
            ? static_cast<uint8_t>(ScanFlags::kTerminatesLiteral)
            : 0) |
-      // Possible string termination characters.
-      ((c == '\'' || c == '"' || c == '\n' || c == '\r' || c == '\\')
-           ? static_cast<uint8_t>(ScanFlags::kStringTerminator)
-           : 0) |
       // Escapes are processed on the slow path.
       (c == '\\' ? static_cast<uint8_t>(ScanFlags::kIdentifierNeedsSlowPath)
                  : 0) |
@@ -244,9 +239,6 @@ inline bool MultilineCommentCharacterNeedsSlowPath(uint8_t scan_flags) {
   return (scan_flags & static_cast<uint8_t>(
                            ScanFlags::kMultilineCommentCharacterNeedsSlowPath));
 }
-inline bool MayTerminateString(uint8_t scan_flags) {
-  return (scan_flags & static_cast<uint8_t>(ScanFlags::kStringTerminator));
-}
 // Table of precomputed scan flags for the 128 ASCII characters, for branchless
 // flag calculation during the scan.
 static constexpr const uint8_t character_scan_flags[128] = {
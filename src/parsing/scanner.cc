@@ -12,16 +12,142 @@
 #include <optional>
 
 #include "src/ast/ast-value-factory.h"
+#include "src/base/bits.h"
 #include "src/base/strings.h"
 #include "src/numbers/conversions-inl.h"
 #include "src/numbers/conversions.h"
 #include "src/objects/bigint.h"
 #include "src/parsing/parse-info.h"
 #include "src/parsing/scanner-inl.h"
+#include "src/utils/utils.h"
 #include "src/zone/zone.h"
 
 namespace v8::internal {
 
+namespace {
+
+// Block-based search helpers for the scanner's hottest skipping loops (long
+// comments and string literals). Each matcher tests a whole vector of UTF-16
+// code units at once where SSE or Neon is available, and a single code unit
+// otherwise.
+
+// Matches exactly one code unit.
+class CodeUnitMatcher {
+ public:
+  explicit CodeUnitMatcher(uint16_t code_unit) : code_unit_(code_unit) {}
+
+  bool Matches(uint16_t c) const { return c == code_unit_; }
+#if defined(__SSE3__)
+  __m128i Matches(__m128i block) const {
+    return _mm_cmpeq_epi16(block, _mm_set1_epi16(code_unit_));
+  }
+#elif defined(V8_OPTIMIZE_WITH_NEON)
+  uint16x8_t Matches(uint16x8_t block) const {
+    return vceqq_u16(block, vdupq_n_u16(code_unit_));
+  }
+#endif
+
+ private:
+  const uint16_t code_unit_;
+};
+
+// Matches LF, CR, LS (U+2028) and PS (U+2029).
+class LineTerminatorMatcher {
+ public:
+  bool Matches(uint16_t c) const { return unibrow::IsLineTerminator(c); }
+#if defined(__SSE3__)
+  __m128i Matches(__m128i block) const {
+    __m128i lf = _mm_cmpeq_epi16(block, _mm_set1_epi16('\n'));
+    __m128i cr = _mm_cmpeq_epi16(block, _mm_set1_epi16('\r'));
+    // LS and PS only differ in the lowest bit.
+    __m128i ls_ps = _mm_cmpeq_epi16(
+        _mm_and_si128(block, _mm_set1_epi16(static_cast<int16_t>(0xFFFE))),
+        _mm_set1_epi16(0x2028));
+    return _mm_or_si128(_mm_or_si128(lf, cr), ls_ps);
+  }
+#elif defined(V8_OPTIMIZE_WITH_NEON)
+  uint16x8_t Matches(uint16x8_t block) const {
+    uint16x8_t lf = vceqq_u16(block, vdupq_n_u16('\n'));
+    uint16x8_t cr = vceqq_u16(block, vdupq_n_u16('\r'));
+    uint16x8_t ls_ps = vceqq_u16(vandq_u16(block, vdupq_n_u16(0xFFFE)),
+                                 vdupq_n_u16(0x2028));
+    return vorrq_u16(vorrq_u16(lf, cr), ls_ps);
+  }
+#endif
+};
+
+// Matches everything that ends the plain ASCII part of a string literal
+// delimited by |quote|: the quote itself, escapes, line terminators and all
+// non-ASCII code units (which are left to the slow path).
+class StringLiteralMatcher {
+ public:
+  explicit StringLiteralMatcher(uint16_t quote) : quote_(quote) {}
+
+  static constexpr uint16_t kMaxAscii = 127;
+
+  bool Matches(uint16_t c) const {
+    return c == quote_ || c == '\\' || c == '\n' || c == '\r' ||
+           c > kMaxAscii;
+  }
+#if defined(__SSE3__)
+  __m128i Matches(__m128i block) const {
+    __m128i quote = _mm_cmpeq_epi16(block, _mm_set1_epi16(quote_));
+    __m128i backslash = _mm_cmpeq_epi16(block, _mm_set1_epi16('\\'));
+    __m128i lf = _mm_cmpeq_epi16(block, _mm_set1_epi16('\n'));
+    __m128i cr = _mm_cmpeq_epi16(block, _mm_set1_epi16('\r'));
+    __m128i ascii = _mm_cmpeq_epi16(
+        _mm_and_si128(block, _mm_set1_epi16(static_cast<int16_t>(~kMaxAscii))),
+        _mm_setzero_si128());
+    return _mm_or_si128(_mm_or_si128(_mm_or_si128(quote, backslash),
+                                     _mm_or_si128(lf, cr)),
+                        _mm_andnot_si128(ascii, _mm_set1_epi16(-1)));
+  }
+#elif defined(V8_OPTIMIZE_WITH_NEON)
+  uint16x8_t Matches(uint16x8_t block) const {
+    uint16x8_t quote = vceqq_u16(block, vdupq_n_u16(quote_));
+    uint16x8_t backslash = vceqq_u16(block, vdupq_n_u16('\\'));
+    uint16x8_t lf = vceqq_u16(block, vdupq_n_u16('\n'));
+    uint16x8_t cr = vceqq_u16(block, vdupq_n_u16('\r'));
+    uint16x8_t non_ascii =
+        vtstq_u16(block, vdupq_n_u16(static_cast<uint16_t>(~kMaxAscii)));
+    return vorrq_u16(vorrq_u16(vorrq_u16(quote, backslash), vorrq_u16(lf, cr)),
+                     non_ascii);
+  }
+#endif
+
+ private:
+  const uint16_t quote_;
+};
+
+// Returns the first position in [start, end) matched by |matcher|, or |end|.
+template <typename Matcher>
+V8_INLINE V8_CLANG_NO_SANITIZE("alignment") const uint16_t* FindFirstMatch(
+    const uint16_t* start, const uint16_t* end, const Matcher& matcher) {
+#if defined(__SSE3__)
+  constexpr ptrdiff_t kBlockSize = sizeof(__m128i) / sizeof(uint16_t);
+  for (; end - start >= kBlockSize; start += kBlockSize) {
+    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(start));
+    uint32_t mask =
+        static_cast<uint32_t>(_mm_movemask_epi8(matcher.Matches(block)));
+    if (mask != 0) {
+      // Every matching code unit sets two bits in the byte mask.
+      return start + base::bits::CountTrailingZeros(mask) / 2;
+    }
+  }
+#elif defined(V8_OPTIMIZE_WITH_NEON)
+  constexpr ptrdiff_t kBlockSize = sizeof(uint16x8_t) / sizeof(uint16_t);
+  for (; end - start >= kBlockSize; start += kBlockSize) {
+    uint16x8_t block = vld1q_u16(start);
+    // Let the scalar loop below find the exact position within the block.
+    if (vmaxvq_u16(matcher.Matches(block)) != 0) break;
+  }
+#endif
+  return std::find_if(start, end,
+                      [&matcher](uint16_t c) { return matcher.Matches(c); });
+}
+
+}  // namespace
+
 class Scanner::ErrorState {
  public:
   ErrorState(MessageTemplate* message_stack, Scanner::Location* location_stack)
@@ -236,7 +362,11 @@ Token::Value Scanner::SkipSingleLineComment() {
   // separately by the lexical grammar and becomes part of the
   // stream of input elements for the syntactic grammar (see
   // ECMA-262, section 7.4).
-  AdvanceUntil([](base::uc32 c0) { return unibrow::IsLineTerminator(c0); });
+  AdvanceUntilInBlocks(
+      [](const uint16_t* start, const uint16_t* end) {
+        return FindFirstMatch(start, end, LineTerminatorMatcher());
+      },
+      [](const uint16_t* start, const uint16_t* end) {});
 
   return Token::kWhitespace;
 }
@@ -340,7 +470,11 @@ Token::Value Scanner::SkipMultiLineComment() {
 
   // After we've seen newline, simply try to find '*/'.
   while (c0_ != kEndOfInput) {
-    AdvanceUntil([](base::uc32 c0) { return c0 == '*'; });
+    AdvanceUntilInBlocks(
+        [](const uint16_t* start, const uint16_t* end) {
+          return FindFirstMatch(start, end, CodeUnitMatcher('*'));
+        },
+        [](const uint16_t* start, const uint16_t* end) {});
 
     while (c0_ == '*') {
       Advance();
@@ -494,19 +628,17 @@ Token::Value Scanner::ScanString() {
 
   next().literal_chars.Start();
   while (true) {
-    AdvanceUntil([this](base::uc32 c0) {
-      if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
-        if (V8_UNLIKELY(unibrow::IsStringLiteralLineTerminator(c0))) {
-          return true;
-        }
-        AddLiteralChar(c0);
-        return false;
-      }
-      uint8_t char_flags = character_scan_flags[c0];
-      if (MayTerminateString(char_flags)) return true;
-      AddLiteralChar(c0);
-      return false;
-    });
+    // Copy the plain ASCII prefix of the literal in blocks; anything else
+    // (including non-ASCII characters) is handled one by one below.
+    const StringLiteralMatcher matcher(static_cast<uint16_t>(quote));
+    AdvanceUntilInBlocks(
+        [&matcher](const uint16_t* start, const uint16_t* end) {
+          return FindFirstMatch(start, end, matcher);
+        },
+        [this](const uint16_t* start, const uint16_t* end) {
+          next().literal_chars.AddAsciiChars(base::Vector<const uint16_t>(
+              start, static_cast<size_t>(end - start)));
+        });
 
     while (c0_ == '\\') {
       Advance();
@@ -95,6 +95,30 @@ class Utf16CharacterStream {
     }
   }
 
+  // Like AdvanceUntil, but |find| locates the next interesting code unit in a
+  // whole [start, end) range of the buffer at once, so that it can compare
+  // several code units per step. Each skipped run of code units is passed to
+  // |on_run| before the cursor moves past it.
+  template <typename FindFunction, typename RunFunction>
+  V8_INLINE base::uc32 AdvanceUntilInBlocks(FindFunction find,
+                                            RunFunction on_run) {
+    while (true) {
+      const uint16_t* next_cursor_pos = find(buffer_cursor_, buffer_end_);
+      on_run(buffer_cursor_, next_cursor_pos);
+
+      if (next_cursor_pos == buffer_end_) {
+        buffer_cursor_ = buffer_end_;
+        if (!ReadBlockChecked(pos())) {
+          buffer_cursor_++;
+          return kEndOfInput;
+        }
+      } else {
+        buffer_cursor_ = next_cursor_pos + 1;
+        return static_cast<base::uc32>(*next_cursor_pos);
+      }
+    }
+  }
+
   // Go back one by one character in the input stream.
   // This undoes the most recent Advance().
   inline void Back() {
@@ -559,6 +583,11 @@ class V8_EXPORT_PRIVATE Scanner {
     c0_ = source_->AdvanceUntil(check);
   }
 
+  template <typename FindFunction, typename RunFunction>
+  V8_INLINE void AdvanceUntilInBlocks(FindFunction find, RunFunction on_run) {
+    c0_ = source_->AdvanceUntilInBlocks(find, on_run);
+  }
+
   bool CombineSurrogatePair() {
     DCHECK(!unibrow::Utf16::IsLeadSurrogate(kEndOfInput));
     if (unibrow::Utf16::IsLeadSurrogate(c0_)) {
@@ -4,6 +4,7 @@
 
 #include "src/regexp/experimental/experimental-interpreter.h"
 
+#include <algorithm>
 #include <optional>
 #include <string>
 
@@ -15,6 +16,7 @@
 #include "src/regexp/experimental/experimental.h"
 #include "src/strings/char-predicates-inl.h"
 #include "src/zone/zone-allocator.h"
+#include "src/zone/zone-containers.h"
 #include "src/zone/zone-list-inl.h"
 
 namespace v8 {
@@ -301,6 +303,7 @@ class NfaInterpreter {
         lookbehind_pc_(0, zone),
         filter_groups_pc_(std::nullopt),
         lookbehind_table_(0, zone),
+        first_character_ranges_(0, zone),
         zone_(zone) {
     DCHECK(!bytecode_.empty());
     DCHECK_GE(input_index_, 0);
@@ -357,6 +360,8 @@ class NfaInterpreter {
 
     std::fill(pc_last_input_index_.begin(), pc_last_input_index_.end(),
               LastInputIndex());
+
+    ComputeFirstCharacterRanges();
   }
 
   // Finds matches and writes their concatenated capture registers to
@@ -581,6 +586,12 @@ class NfaInterpreter {
            !(FoundMatch() && blocked_threads_.is_empty())) {
       DCHECK(active_threads_.is_empty());
       base::uc16 input_char = input_[input_index_];
+
+      if (CanSkipInput(input_char)) {
+        err_code = SkipToNextFirstCharacter();
+        if (err_code != RegExp::kInternalRegExpSuccess) return err_code;
+        continue;
+      }
       ++input_index_;
 
       std::fill(lookbehind_table_.begin(), lookbehind_table_.end(), false);
@@ -602,6 +613,133 @@ class NfaInterpreter {
     return RegExp::kInternalRegExpSuccess;
   }
 
+  // Unanchored regexps start with the /.*?/ preamble emitted by
+  // `CompileVisitor`:
+  //
+  //     0: FORK 2
+  //     1: JMP body
+  //     2: BEGIN_LOOP
+  //     3: CONSUME_RANGE [0x0000, 0xFFFF]
+  //     4: END_LOOP
+  //     5: FORK 2
+  //   body:
+  //     ...
+  //
+  // If no character at a given position can be consumed by any thread other
+  // than the preamble's, then all of them die, and the state at the next
+  // position is the same as when starting a fresh search there. If moreover
+  // the body can only start by consuming a character from a small set (the
+  // first characters), we can skip over all input that doesn't contain one of
+  // them without running any threads, much like a compiled matcher would do
+  // with a quick check. This computes the first characters, or leaves
+  // `first_character_ranges_` empty if the optimization doesn't apply.
+  void ComputeFirstCharacterRanges() {
+    static constexpr int kPreambleLength = 6;
+    if (!lookbehind_pc_.is_empty()) return;
+    if (bytecode_.length() <= kPreambleLength) return;
+    if (bytecode_[0].opcode != RegExpInstruction::FORK ||
+        bytecode_[0].payload.pc != 2 ||
+        bytecode_[1].opcode != RegExpInstruction::JMP ||
+        bytecode_[1].payload.pc != kPreambleLength ||
+        bytecode_[2].opcode != RegExpInstruction::BEGIN_LOOP ||
+        bytecode_[kPreambleConsumePc].opcode !=
+            RegExpInstruction::CONSUME_RANGE ||
+        bytecode_[kPreambleConsumePc].payload.consume_range.min != 0x0000 ||
+        bytecode_[kPreambleConsumePc].payload.consume_range.max != 0xFFFF ||
+        bytecode_[4].opcode != RegExpInstruction::END_LOOP ||
+        bytecode_[5].opcode != RegExpInstruction::FORK ||
+        bytecode_[5].payload.pc != 2) {
+      return;
+    }
+
+    // Walk all paths from the start of the body that don't consume input. Give
+    // up on anything whose outcome depends on more than the next character.
+    static constexpr int kMaxFirstCharacterRanges = 8;
+    ZoneList<RegExpInstruction::Uc16Range> ranges(kMaxFirstCharacterRanges,
+                                                  zone_);
+    ZoneList<bool> visited(bytecode_.length(), zone_);
+    visited.AddBlock(false, bytecode_.length(), zone_);
+    ZoneList<int> worklist(4, zone_);
+    worklist.Add(kPreambleLength, zone_);
+    while (!worklist.is_empty()) {
+      int pc = worklist.RemoveLast();
+      if (visited[pc]) continue;
+      visited[pc] = true;
+      RegExpInstruction inst = bytecode_[pc];
+      switch (inst.opcode) {
+        case RegExpInstruction::CONSUME_RANGE: {
+          RegExpInstruction::Uc16Range range = inst.payload.consume_range;
+          if (range.min > range.max) break;  // Never matches.
+          if (ranges.length() == kMaxFirstCharacterRanges) return;
+          ranges.Add(range, zone_);
+          break;
+        }
+        case RegExpInstruction::FORK:
+          worklist.Add(inst.payload.pc, zone_);
+          worklist.Add(pc + 1, zone_);
+          break;
+        case RegExpInstruction::JMP:
+          worklist.Add(inst.payload.pc, zone_);
+          break;
+        case RegExpInstruction::SET_REGISTER_TO_CP:
+        case RegExpInstruction::CLEAR_REGISTER:
+        case RegExpInstruction::SET_QUANTIFIER_TO_CLOCK:
+        case RegExpInstruction::BEGIN_LOOP:
+          worklist.Add(pc + 1, zone_);
+          break;
+        default:
+          // Assertions and lookarounds depend on the surrounding input, and
+          // bodies that can ACCEPT without input match everywhere.
+          return;
+      }
+    }
+
+    for (RegExpInstruction::Uc16Range range : ranges) {
+      // A body that can start with any character can't skip anything.
+      if (range.min == 0x0000 && range.max == 0xFFFF) return;
+    }
+    first_character_ranges_ = std::move(ranges);
+  }
+
+  bool IsFirstCharacter(base::uc16 c) const {
+    for (RegExpInstruction::Uc16Range range : first_character_ranges_) {
+      if (c >= range.min && c <= range.max) return true;
+    }
+    return false;
+  }
+
+  // Returns whether feeding `c` would kill every thread other than the
+  // preamble's, see `ComputeFirstCharacterRanges`.
+  bool CanSkipInput(base::uc16 c) const {
+    if (first_character_ranges_.is_empty() || FoundMatch()) return false;
+    if (IsFirstCharacter(c)) return false;
+    for (const InterpreterThread& t : blocked_threads_) {
+      if (t.pc == kPreambleConsumePc) continue;
+      RegExpInstruction::Uc16Range range =
+          bytecode_[t.pc].payload.consume_range;
+      if (c >= range.min && c <= range.max) return false;
+    }
+    return true;
+  }
+
+  // Advances `input_index_` past the current character and all following
+  // characters that can't start a match, then restarts the search there.
+  int SkipToNextFirstCharacter() {
+    int index = input_index_ + 1;
+    while (index != input_.length() && !IsFirstCharacter(input_[index])) {
+      ++index;
+    }
+
+    for (InterpreterThread t : blocked_threads_) {
+      DestroyThread(t);
+    }
+    blocked_threads_.Rewind(0);
+
+    SetInputIndex(index);
+    active_threads_.Add(NewEmptyThread(0), zone_);
+    return RunActiveThreads();
+  }
+
   // Run an active thread `t` until it executes a CONSUME_RANGE or ACCEPT
   // instruction, or its PC value was already processed.
   // - If processing of `t` can't continue because of CONSUME_RANGE, it is
@@ -1089,6 +1227,14 @@ class NfaInterpreter {
   // lookbehind of index k did complete a match on the current position.
   ZoneList<bool> lookbehind_table_;
 
+  // PC of the CONSUME_RANGE instruction of the /.*?/ preamble.
+  static constexpr int kPreambleConsumePc = 3;
+
+  // Ranges of the characters that a match can start with, if the search can
+  // skip input that can't start a match. Computed during the NFA instantiation
+  // (see `ComputeFirstCharacterRanges`).
+  ZoneList<RegExpInstruction::Uc16Range> first_character_ranges_;
+
   uint64_t memory_consumption_per_thread_;
 
   Zone* zone_;
@@ -1100,10 +1246,20 @@ int ExperimentalRegExpInterpreter::FindMatches(
     Isolate* isolate, RegExp::CallOrigin call_origin,
     Tagged<TrustedByteArray> bytecode, int register_count_per_match,
     Tagged<String> input, int start_index, int32_t* output_registers,
-    int output_register_count, Zone* zone) {
+    int output_register_count, Zone* zone,
+    ExperimentalRegExpLazyDfa* lazy_dfa) {
   DCHECK(input->IsFlat());
   DisallowGarbageCollection no_gc;
 
+  if (lazy_dfa != nullptr) {
+    // Most searches over near-miss inputs fail. Find out cheaply whether
+    // there is any match before running the NFA to compute the captures. If
+    // the DFA stopped for an interrupt, the NFA handles it.
+    std::optional<bool> has_match =
+        lazy_dfa->HasMatch(isolate, input, start_index);
+    if (has_match.has_value() && !*has_match) return 0;
+  }
+
   if (input->GetFlatContent(no_gc).IsOneByte()) {
     NfaInterpreter<uint8_t> interpreter(isolate, call_origin, bytecode,
                                         register_count_per_match, input,
@@ -1118,5 +1274,314 @@ int ExperimentalRegExpInterpreter::FindMatches(
   }
 }
 
+struct ExperimentalRegExpLazyDfa::State {
+  // Sorted ids of the threads blocked on a CONSUME_RANGE.
+  base::Vector<const int> threads;
+  // Sorted indices of the programs that matched so far.
+  base::Vector<const int> matched_programs;
+};
+
+struct ExperimentalRegExpLazyDfa::Cache {
+  explicit Cache(AccountingAllocator* allocator)
+      : zone(allocator, ZONE_NAME),
+        states(&zone),
+        state_ids(&zone),
+        transitions(&zone) {}
+
+  Zone zone;
+  ZoneVector<State> states;
+  // Maps the sorted threads of a state, followed by -1 and the matched
+  // programs, to the index of the state in `states`.
+  ZoneUnorderedMap<base::Vector<const int>, int> state_ids;
+  // transitions[state * class count + class] is the index of the next state.
+  ZoneVector<int> transitions;
+};
+
+namespace {
+
+constexpr int kUnknownState = -1;
+// Upper bound on the number of entries in the transition table.
+constexpr size_t kMaxLazyDfaTransitionCount = 1 << 16;
+
+int ThreadId(int pc, bool consumed) { return pc << 1 | consumed; }
+
+}  // namespace
+
+ExperimentalRegExpLazyDfa::ExperimentalRegExpLazyDfa(Zone* zone)
+    : zone_(zone),
+      bytecode_(zone),
+      program_starts_(zone),
+      program_of_pc_(zone),
+      class_starts_(zone),
+      worklist_(zone),
+      closure_(zone),
+      key_(zone),
+      matched_(zone),
+      visited_(zone) {}
+
+ExperimentalRegExpLazyDfa::ExperimentalRegExpLazyDfa(
+    AccountingAllocator* allocator)
+    : owned_zone_(std::make_unique<Zone>(allocator, ZONE_NAME)),
+      zone_(owned_zone_.get()),
+      bytecode_(zone_),
+      program_starts_(zone_),
+      program_of_pc_(zone_),
+      class_starts_(zone_),
+      worklist_(zone_),
+      closure_(zone_),
+      key_(zone_),
+      matched_(zone_),
+      visited_(zone_) {}
+
+ExperimentalRegExpLazyDfa::~ExperimentalRegExpLazyDfa() = default;
+
+bool ExperimentalRegExpLazyDfa::AddProgram(
+    base::Vector<const RegExpInstruction> program) {
+  for (const RegExpInstruction& inst : program) {
+    switch (inst.opcode) {
+      case RegExpInstruction::ASSERTION:
+      case RegExpInstruction::WRITE_LOOKBEHIND_TABLE:
+      case RegExpInstruction::READ_LOOKBEHIND_TABLE:
+        return false;
+      default:
+        break;
+    }
+  }
+
+  const int offset = static_cast<int>(bytecode_.size());
+  const int index = program_count();
+  program_starts_.push_back(offset);
+  for (RegExpInstruction inst : program) {
+    switch (inst.opcode) {
+      case RegExpInstruction::FORK:
+      case RegExpInstruction::JMP:
+      case RegExpInstruction::FILTER_CHILD:
+        inst.payload.pc += offset;
+        break;
+      default:
+        break;
+    }
+    bytecode_.push_back(inst);
+    program_of_pc_.push_back(index);
+  }
+  cache_.reset();
+  return true;
+}
+
+base::Vector<const int> ExperimentalRegExpLazyDfa::FindMatchingPrograms(
+    Tagged<String> input, int start_index, bool stop_at_first_match) {
+  DisallowGarbageCollection no_gc;
+  if (!cache_) ResetCache();
+  String::FlatContent content = input->GetFlatContent(no_gc);
+  if (content.IsOneByte()) {
+    return *Run(content.ToOneByteVector(), start_index, stop_at_first_match,
+                nullptr);
+  }
+  return *Run(content.ToUC16Vector(), start_index, stop_at_first_match,
+              nullptr);
+}
+
+std::optional<bool> ExperimentalRegExpLazyDfa::HasMatch(Isolate* isolate,
+                                                        Tagged<String> input,
+                                                        int start_index) {
+  DisallowGarbageCollection no_gc;
+  if (!cache_) ResetCache();
+  String::FlatContent content = input->GetFlatContent(no_gc);
+  std::optional<base::Vector<const int>> matched_programs =
+      content.IsOneByte()
+          ? Run(content.ToOneByteVector(), start_index, true, isolate)
+          : Run(content.ToUC16Vector(), start_index, true, isolate);
+  if (!matched_programs.has_value()) return std::nullopt;
+  return !matched_programs->empty();
+}
+
+size_t ExperimentalRegExpLazyDfa::EstimateCurrentMemoryConsumption() const {
+  size_t size = sizeof(*this);
+  if (owned_zone_) size += sizeof(Zone) + owned_zone_->allocation_size();
+  if (cache_) size += sizeof(Cache) + cache_->zone.allocation_size();
+  return size;
+}
+
+void ExperimentalRegExpLazyDfa::ResetCache() {
+  if (cache_) {
+    ++cache_resets_;
+  } else {
+    // The set of programs changed, recompute everything derived from it.
+    class_starts_.clear();
+    class_starts_.push_back(0);
+    for (const RegExpInstruction& inst : bytecode_) {
+      if (inst.opcode != RegExpInstruction::CONSUME_RANGE) continue;
+      RegExpInstruction::Uc16Range range = inst.payload.consume_range;
+      if (range.min > range.max) continue;
+      class_starts_.push_back(range.min);
+      if (range.max != 0xFFFF) class_starts_.push_back(range.max + 1);
+    }
+    std::sort(class_starts_.begin(), class_starts_.end());
+    class_starts_.erase(
+        std::unique(class_starts_.begin(), class_starts_.end()),
+        class_starts_.end());
+    for (int c = 0; c < kLatin1ClassCacheSize; ++c) {
+      latin1_classes_[c] = ComputeClassOf(c);
+    }
+
+    visited_.resize(2 * bytecode_.size());
+    std::fill(visited_.begin(), visited_.end(), 0);
+    epoch_ = 0;
+    matched_.resize(program_starts_.size());
+  }
+  cache_ = std::make_unique<Cache>(zone_->allocator());
+}
+
+template <class Character>
+std::optional<base::Vector<const int>> ExperimentalRegExpLazyDfa::Run(
+    base::Vector<const Character> input, int start_index,
+    bool stop_at_first_match, Isolate* isolate) {
+  DCHECK_LE(start_index, input.length());
+  for (int start : program_starts_) {
+    worklist_.push_back(ThreadId(start, true));
+  }
+  std::fill(matched_.begin(), matched_.end(), false);
+  int state = AddClosureState();
+
+  const size_t class_count = class_starts_.size();
+  for (int i = start_index;; ++i) {
+    const State& current = cache_->states[state];
+    if (stop_at_first_match && !current.matched_programs.empty()) break;
+    if (current.threads.empty() || i == input.length()) break;
+    static constexpr int kTicksBetweenInterruptChecks = 64;
+    if (isolate != nullptr && i % kTicksBetweenInterruptChecks == 0 &&
+        StackLimitCheck(isolate).InterruptRequested()) {
+      return std::nullopt;
+    }
+    int char_class = ClassOf(input[i]);
+    size_t index = state * class_count + char_class;
+    int next = cache_->transitions[index];
+    if (next == kUnknownState) {
+      int cache_resets = cache_resets_;
+      next = ComputeTransition(state, char_class);
+      // After a reset, `index` refers to a state that no longer exists.
+      if (cache_resets == cache_resets_) cache_->transitions[index] = next;
+    }
+    state = next;
+  }
+  return cache_->states[state].matched_programs;
+}
+
+int ExperimentalRegExpLazyDfa::ComputeClassOf(base::uc16 c) const {
+  return static_cast<int>(std::upper_bound(class_starts_.begin(),
+                                           class_starts_.end(), c) -
+                          class_starts_.begin()) -
+         1;
+}
+
+int ExperimentalRegExpLazyDfa::ClassOf(base::uc16 c) const {
+  if (c < kLatin1ClassCacheSize) return latin1_classes_[c];
+  return ComputeClassOf(c);
+}
+
+int ExperimentalRegExpLazyDfa::ComputeTransition(int state, int char_class) {
+  const State& current = cache_->states[state];
+  base::uc16 c = class_starts_[char_class];
+  for (int thread : current.threads) {
+    int pc = thread >> 1;
+    RegExpInstruction::Uc16Range range = bytecode_[pc].payload.consume_range;
+    if (c >= range.min && c <= range.max) {
+      worklist_.push_back(ThreadId(pc + 1, true));
+    }
+  }
+  std::fill(matched_.begin(), matched_.end(), false);
+  for (int program : current.matched_programs) matched_[program] = true;
+  return AddClosureState();
+}
+
+// Runs the threads in `worklist_` until they block, and returns the index of
+// the state made up of the blocked threads and the programs in `matched_`.
+int ExperimentalRegExpLazyDfa::AddClosureState() {
+  ++epoch_;
+  closure_.clear();
+  while (!worklist_.empty()) {
+    int thread = worklist_.back();
+    worklist_.pop_back();
+    int pc = thread >> 1;
+    bool consumed = thread & 1;
+    SBXCHECK_BOUNDS(pc, bytecode_.size());
+    if (visited_[thread] == epoch_) continue;
+    visited_[thread] = epoch_;
+    // Once a program matched, its threads don't matter anymore.
+    if (matched_[program_of_pc_[pc]]) continue;
+
+    RegExpInstruction inst = bytecode_[pc];
+    switch (inst.opcode) {
+      case RegExpInstruction::CONSUME_RANGE:
+        closure_.push_back(thread);
+        break;
+      case RegExpInstruction::ACCEPT:
+        matched_[program_of_pc_[pc]] = true;
+        break;
+      case RegExpInstruction::FORK:
+        worklist_.push_back(ThreadId(inst.payload.pc, consumed));
+        worklist_.push_back(ThreadId(pc + 1, consumed));
+        break;
+      case RegExpInstruction::JMP:
+        worklist_.push_back(ThreadId(inst.payload.pc, consumed));
+        break;
+      case RegExpInstruction::SET_REGISTER_TO_CP:
+      case RegExpInstruction::CLEAR_REGISTER:
+      case RegExpInstruction::SET_QUANTIFIER_TO_CLOCK:
+        worklist_.push_back(ThreadId(pc + 1, consumed));
+        break;
+      case RegExpInstruction::BEGIN_LOOP:
+        worklist_.push_back(ThreadId(pc + 1, false));
+        break;
+      case RegExpInstruction::END_LOOP:
+        // Quantifier iterations must not match the empty string.
+        if (consumed) worklist_.push_back(ThreadId(pc + 1, consumed));
+        break;
+      case RegExpInstruction::FILTER_QUANTIFIER:
+      case RegExpInstruction::FILTER_GROUP:
+      case RegExpInstruction::FILTER_CHILD:
+        // Only reachable through the filter tree, not by threads.
+      case RegExpInstruction::ASSERTION:
+      case RegExpInstruction::WRITE_LOOKBEHIND_TABLE:
+      case RegExpInstruction::READ_LOOKBEHIND_TABLE:
+        // Rejected by `AddProgram`.
+        UNREACHABLE();
+    }
+  }
+
+  // Threads of programs that matched after they were blocked are dropped.
+  key_.clear();
+  for (int thread : closure_) {
+    if (!matched_[program_of_pc_[thread >> 1]]) key_.push_back(thread);
+  }
+  std::sort(key_.begin(), key_.end());
+  const size_t thread_count = key_.size();
+  key_.push_back(-1);
+  for (int program = 0; program < program_count(); ++program) {
+    if (matched_[program]) key_.push_back(program);
+  }
+
+  base::Vector<const int> key(key_.data(), key_.size());
+  auto it = cache_->state_ids.find(key);
+  if (it != cache_->state_ids.end()) return it->second;
+
+  // Flush the cache instead of giving up, so that a search always takes time
+  // linear in the input length.
+  if ((cache_->states.size() + 1) * class_starts_.size() >
+      kMaxLazyDfaTransitionCount) {
+    ResetCache();
+  }
+  int* key_copy = cache_->zone.AllocateArray<int>(key.size());
+  std::copy(key.begin(), key.end(), key_copy);
+  key = base::Vector<const int>(key_copy, key.size());
+  int id = static_cast<int>(cache_->states.size());
+  cache_->states.push_back({key.SubVector(0, thread_count),
+                            key.SubVector(thread_count + 1, key.size())});
+  cache_->state_ids.emplace(key, id);
+  cache_->transitions.resize(cache_->transitions.size() + class_starts_.size(),
+                             kUnknownState);
+  return id;
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -5,12 +5,19 @@
 #ifndef V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_INTERPRETER_H_
 #define V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_INTERPRETER_H_
 
+#include <array>
+#include <memory>
+#include <optional>
+
 #include "src/regexp/experimental/experimental-bytecode.h"
 #include "src/regexp/regexp.h"
+#include "src/zone/zone-containers.h"
 
 namespace v8 {
 namespace internal {
 
+class AccountingAllocator;
+class ExperimentalRegExpLazyDfa;
 class TrustedByteArray;
 class String;
 class Zone;
@@ -22,12 +29,102 @@ class ExperimentalRegExpInterpreter final : public AllStatic {
   // `max_match_num` matches in `input`, starting at `start_index`.  Returns
   // the actual number of matches found.  The boundaries of matching subranges
   // are written to `matches_out`.  Provided in variants for one-byte and
-  // two-byte strings.
+  // two-byte strings. If `lazy_dfa` is not null, it must hold the bytecode
+  // program, and it is used to check whether there is any match first.
   static int FindMatches(Isolate* isolate, RegExp::CallOrigin call_origin,
                          Tagged<TrustedByteArray> bytecode, int capture_count,
                          Tagged<String> input, int start_index,
                          int32_t* output_registers, int output_register_count,
-                         Zone* zone);
+                         Zone* zone,
+                         ExperimentalRegExpLazyDfa* lazy_dfa = nullptr);
+};
+
+// Finds out which of a set of bytecode programs match somewhere in an input,
+// by running them together as a lazily built deterministic automaton (as RE2
+// does). Since any match will do, thread priorities and registers don't
+// matter. A DFA state is the set of blocked NFA threads, identified by their
+// pc and consumed_since_last_quantifier value, together with the programs
+// that have matched so far. States and transitions are computed on demand and
+// cached across searches. The cache is flushed when it grows too large, so
+// that searches take time linear in the input length. Programs whose outcome
+// depends on more than the next character (assertions and lookbehinds) are
+// not supported.
+class ExperimentalRegExpLazyDfa final {
+ public:
+  explicit ExperimentalRegExpLazyDfa(Zone* zone);
+  // Creates a DFA that allocates in a zone of its own, for DFAs that are not
+  // scoped to a zone, like the ones kept on regexps.
+  explicit ExperimentalRegExpLazyDfa(AccountingAllocator* allocator);
+  ~ExperimentalRegExpLazyDfa();
+
+  // Adds `program` to the set. Returns false, leaving the set unchanged, if
+  // the DFA can't run it.
+  bool AddProgram(base::Vector<const RegExpInstruction> program);
+
+  int program_count() const {
+    return static_cast<int>(program_starts_.size());
+  }
+
+  // Returns the indices of the programs that match in `input` at or after
+  // `start_index`, in increasing order. If `stop_at_first_match`, the search
+  // stops as soon as any program matched. The result is only valid until the
+  // next call. `input` must be flat.
+  base::Vector<const int> FindMatchingPrograms(Tagged<String> input,
+                                               int start_index,
+                                               bool stop_at_first_match);
+
+  // Returns whether any program matches in `input` at or after
+  // `start_index`. Checks for interrupts every few characters like the NFA
+  // interpreter, but leaves handling them to the caller: returns std::nullopt
+  // if `isolate` has one pending. `input` must be flat.
+  std::optional<bool> HasMatch(Isolate* isolate, Tagged<String> input,
+                               int start_index);
+
+  // Returns the number of bytes held by the DFA, including its own zone (if
+  // any) and the state cache. Grows as states are computed and shrinks when
+  // the cache is flushed.
+  size_t EstimateCurrentMemoryConsumption() const;
+
+ private:
+  struct State;
+  struct Cache;
+
+  static constexpr int kLatin1ClassCacheSize = 256;
+
+  // Returns std::nullopt if `isolate` is not null and has an interrupt
+  // pending.
+  template <class Character>
+  std::optional<base::Vector<const int>> Run(
+      base::Vector<const Character> input, int start_index,
+      bool stop_at_first_match, Isolate* isolate);
+  void ResetCache();
+  int ClassOf(base::uc16 c) const;
+  int ComputeClassOf(base::uc16 c) const;
+  int ComputeTransition(int state, int char_class);
+  int AddClosureState();
+
+  // Only set if the DFA owns its zone.
+  std::unique_ptr<Zone> owned_zone_;
+  Zone* const zone_;
+  // The programs, relocated to follow each other.
+  ZoneVector<RegExpInstruction> bytecode_;
+  ZoneVector<int> program_starts_;
+  ZoneVector<int> program_of_pc_;
+  // The smallest code unit of each character class, sorted. Code units in
+  // the same class are not told apart by any CONSUME_RANGE.
+  ZoneVector<int> class_starts_;
+  std::array<int, kLatin1ClassCacheSize> latin1_classes_;
+  // Scratch space for computing states.
+  ZoneVector<int> worklist_;
+  ZoneVector<int> closure_;
+  ZoneVector<int> key_;
+  ZoneVector<bool> matched_;
+  // visited_[thread] == epoch_ if `thread` is part of the current closure.
+  ZoneVector<int> visited_;
+  int epoch_ = 0;
+  int cache_resets_ = 0;
+  // Null if the cache must be rebuilt before the next search.
+  std::unique_ptr<Cache> cache_;
 };
 
 }  // namespace internal
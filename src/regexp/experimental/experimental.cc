@@ -8,6 +8,7 @@
 
 #include "src/common/assert-scope.h"
 #include "src/objects/js-regexp-inl.h"
+#include "src/objects/managed-inl.h"
 #include "src/regexp/experimental/experimental-compiler.h"
 #include "src/regexp/experimental/experimental-interpreter.h"
 #include "src/regexp/regexp-parser.h"
@@ -108,6 +109,33 @@ std::optional<CompilationResult> CompileImpl(
 
 }  // namespace
 
+base::Vector<RegExpInstruction> AsInstructionSequence(
+    Tagged<TrustedByteArray> raw_bytes) {
+  RegExpInstruction* inst_begin =
+      reinterpret_cast<RegExpInstruction*>(raw_bytes->begin());
+  int inst_num = raw_bytes->length() / sizeof(RegExpInstruction);
+  DCHECK_EQ(sizeof(RegExpInstruction) * inst_num, raw_bytes->length());
+  return base::Vector<RegExpInstruction>(inst_begin, inst_num);
+}
+
+namespace {
+
+// The lazy DFA is built once and kept on the regexp, so that its states and
+// transitions are reused across executions.
+void SetLazyDfa(Isolate* isolate, DirectHandle<IrRegExpData> re_data,
+                Tagged<TrustedByteArray> bytecode) {
+  DCHECK(v8_flags.experimental_regexp_engine_lazy_dfa);
+  auto dfa = std::make_shared<ExperimentalRegExpLazyDfa>(isolate->allocator());
+  if (!dfa->AddProgram(AsInstructionSequence(bytecode))) return;
+  const size_t estimated_size = dfa->EstimateCurrentMemoryConsumption();
+  DirectHandle<TrustedManaged<ExperimentalRegExpLazyDfa>> managed_dfa =
+      TrustedManaged<ExperimentalRegExpLazyDfa>::From(isolate, estimated_size,
+                                                      std::move(dfa));
+  re_data->set_experimental_lazy_dfa(*managed_dfa);
+}
+
+}  // namespace
+
 bool ExperimentalRegExp::Compile(Isolate* isolate,
                                  DirectHandle<IrRegExpData> re_data) {
   DCHECK(v8_flags.enable_experimental_regexp_engine);
@@ -131,16 +159,12 @@ bool ExperimentalRegExp::Compile(Isolate* isolate,
   re_data->SetBytecodeForExperimental(isolate, *compilation_result->bytecode);
   re_data->set_capture_name_map(compilation_result->capture_name_map);
 
-  return true;
-}
+  re_data->clear_experimental_lazy_dfa();
+  if (v8_flags.experimental_regexp_engine_lazy_dfa) {
+    SetLazyDfa(isolate, re_data, *compilation_result->bytecode);
+  }
 
-base::Vector<RegExpInstruction> AsInstructionSequence(
-    Tagged<TrustedByteArray> raw_bytes) {
-  RegExpInstruction* inst_begin =
-      reinterpret_cast<RegExpInstruction*>(raw_bytes->begin());
-  int inst_num = raw_bytes->length() / sizeof(RegExpInstruction);
-  DCHECK_EQ(sizeof(RegExpInstruction) * inst_num, raw_bytes->length());
-  return base::Vector<RegExpInstruction>(inst_begin, inst_num);
+  return true;
 }
 
 namespace {
@@ -148,7 +172,8 @@ namespace {
 int32_t ExecRawImpl(Isolate* isolate, RegExp::CallOrigin call_origin,
                     Tagged<TrustedByteArray> bytecode, Tagged<String> subject,
                     int capture_count, int32_t* output_registers,
-                    int32_t output_register_count, int32_t subject_index) {
+                    int32_t output_register_count, int32_t subject_index,
+                    ExperimentalRegExpLazyDfa* lazy_dfa = nullptr) {
   DisallowGarbageCollection no_gc;
   // TODO(cbruni): remove once gcmole is fixed.
   DisableGCMole no_gc_mole;
@@ -161,7 +186,34 @@ int32_t ExecRawImpl(Isolate* isolate, RegExp::CallOrigin call_origin,
   Zone zone(isolate->allocator(), ZONE_NAME);
   result = ExperimentalRegExpInterpreter::FindMatches(
       isolate, call_origin, bytecode, register_count_per_match, subject,
-      subject_index, output_registers, output_register_count, &zone);
+      subject_index, output_registers, output_register_count, &zone, lazy_dfa);
+  return result;
+}
+
+// Runs the bytecode, checking with the regexp's lazy DFA first if it has one.
+int32_t ExecRawWithLazyDfa(Isolate* isolate, RegExp::CallOrigin call_origin,
+                           Tagged<IrRegExpData> regexp_data,
+                           Tagged<TrustedByteArray> bytecode,
+                           Tagged<String> subject, int32_t* output_registers,
+                           int32_t output_register_count,
+                           int32_t subject_index) {
+  if (!regexp_data->has_experimental_lazy_dfa()) {
+    return ExecRawImpl(isolate, call_origin, bytecode, subject,
+                       regexp_data->capture_count(), output_registers,
+                       output_register_count, subject_index);
+  }
+
+  Tagged<TrustedManaged<ExperimentalRegExpLazyDfa>> managed_dfa =
+      regexp_data->experimental_lazy_dfa();
+  ExperimentalRegExpLazyDfa* lazy_dfa = managed_dfa->raw();
+  int32_t result = ExecRawImpl(isolate, call_origin, bytecode, subject,
+                               regexp_data->capture_count(), output_registers,
+                               output_register_count, subject_index, lazy_dfa);
+  // The DFA computes states on demand and flushes them when its cache is
+  // full, so keep the external memory reported for it up to date. This only
+  // adjusts the counter and can't trigger a GC.
+  managed_dfa->UpdateEstimatedSize(
+      isolate, lazy_dfa->EstimateCurrentMemoryConsumption());
   return result;
 }
 
@@ -186,9 +238,9 @@ int32_t ExperimentalRegExp::ExecRaw(Isolate* isolate,
   static constexpr bool kIsLatin1 = true;
   Tagged<TrustedByteArray> bytecode = regexp_data->bytecode(kIsLatin1);
 
-  return ExecRawImpl(isolate, call_origin, bytecode, subject,
-                     regexp_data->capture_count(), output_registers,
-                     output_register_count, subject_index);
+  return ExecRawWithLazyDfa(isolate, call_origin, regexp_data, bytecode,
+                            subject, output_registers, output_register_count,
+                            subject_index);
 }
 
 int32_t ExperimentalRegExp::MatchForCallFromJs(
@@ -289,11 +341,20 @@ int32_t ExperimentalRegExp::OneshotExecRaw(
       CompileImpl(isolate, regexp_data);
   if (!compilation_result.has_value()) return RegExp::kInternalRegExpException;
 
+  // Patterns that backtrack excessively in Irregexp tend to fall back again
+  // on later executions, and failing searches are common for them. Keep a
+  // lazy DFA on the regexp, so that those are decided in linear time with
+  // its cached states, before the NFA computes the captures of a match.
+  if (v8_flags.experimental_regexp_engine_lazy_dfa &&
+      !regexp_data->has_experimental_lazy_dfa()) {
+    SetLazyDfa(isolate, regexp_data, *compilation_result->bytecode);
+  }
+
   DisallowGarbageCollection no_gc;
-  return ExecRawImpl(isolate, RegExp::kFromRuntime,
-                     *compilation_result->bytecode, *subject,
-                     regexp_data->capture_count(), output_registers,
-                     output_register_count, subject_index);
+  return ExecRawWithLazyDfa(isolate, RegExp::kFromRuntime, *regexp_data,
+                            *compilation_result->bytecode, *subject,
+                            output_registers, output_register_count,
+                            subject_index);
 }
 
 MaybeHandle<Object> ExperimentalRegExp::OneshotExec(
@@ -343,4 +404,26 @@ MaybeHandle<Object> ExperimentalRegExp::OneshotExec(
   UNREACHABLE();
 }
 
+bool ExperimentalRegExp::AddToLazyDfa(Isolate* isolate,
+                                      DirectHandle<JSRegExp> regexp,
+                                      ExperimentalRegExpLazyDfa* dfa) {
+  Zone zone(isolate->allocator(), ZONE_NAME);
+
+  Handle<String> source(regexp->source(), isolate);
+  RegExpFlags flags = JSRegExp::AsRegExpFlags(regexp->flags());
+  RegExpCompileData parse_result;
+  if (!RegExpParser::ParseRegExpFromHeapString(isolate, &zone, source, flags,
+                                               &parse_result)) {
+    return false;
+  }
+  if (!ExperimentalRegExpCompiler::CanBeHandled(parse_result.tree, flags,
+                                                parse_result.capture_count)) {
+    return false;
+  }
+
+  ZoneList<RegExpInstruction> bytecode =
+      ExperimentalRegExpCompiler::Compile(parse_result.tree, flags, &zone);
+  return dfa->AddProgram(bytecode.ToConstVector());
+}
+
 }  // namespace v8::internal
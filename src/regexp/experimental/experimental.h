@@ -11,6 +11,8 @@
 namespace v8 {
 namespace internal {
 
+class ExperimentalRegExpLazyDfa;
+
 class ExperimentalRegExp final : public AllStatic {
  public:
   // Initialization & Compilation
@@ -60,6 +62,12 @@ class ExperimentalRegExp final : public AllStatic {
                                 int32_t output_register_count,
                                 int32_t subject_index);
 
+  // Compiles the regexp with the experimental engine and adds it to `dfa`,
+  // regardless of its type tag. Returns false if the regexp can't be run by
+  // the experimental engine or by the lazy DFA.
+  static bool AddToLazyDfa(Isolate* isolate, DirectHandle<JSRegExp> regexp,
+                           ExperimentalRegExpLazyDfa* dfa);
+
   static constexpr bool kSupportsUnicode = false;
 };
 
@@ -254,7 +254,8 @@ RegExpCompiler::RegExpCompiler(Isolate* isolate, Zone* zone, int capture_count,
       current_expansion_factor_(1),
       frequency_collator_(),
       isolate_(isolate),
-      zone_(zone) {
+      zone_(zone),
+      stack_limit_(isolate->stack_guard()->real_climit()) {
   accept_ = zone->New<EndNode>(EndNode::ACCEPT, zone);
   DCHECK_GE(RegExpMacroAssembler::kMaxRegister, next_register_ - 1);
 }
@@ -3764,15 +3765,16 @@ class EatsAtLeastPropagator : public AllStatic {
 template <typename... Propagators>
 class Analysis : public NodeVisitor {
  public:
-  Analysis(Isolate* isolate, bool is_one_byte, RegExpFlags flags)
+  Analysis(Isolate* isolate, bool is_one_byte, RegExpFlags flags,
+           uintptr_t stack_limit)
       : isolate_(isolate),
         is_one_byte_(is_one_byte),
         flags_(flags),
+        stack_limit_(stack_limit),
         error_(RegExpError::kNone) {}
 
   void EnsureAnalyzed(RegExpNode* that) {
-    StackLimitCheck check(isolate());
-    if (check.HasOverflowed()) {
+    if (GetCurrentStackPosition() < stack_limit_) {
       if (v8_flags.correctness_fuzzer_suppressions) {
         FATAL("Analysis: Aborting on stack overflow");
       }
@@ -3883,15 +3885,16 @@ class Analysis : public NodeVisitor {
   Isolate* isolate_;
   const bool is_one_byte_;
   RegExpFlags flags_;
+  const uintptr_t stack_limit_;
   RegExpError error_;
 
   DISALLOW_IMPLICIT_CONSTRUCTORS(Analysis);
 };
 
 RegExpError AnalyzeRegExp(Isolate* isolate, bool is_one_byte, RegExpFlags flags,
-                          RegExpNode* node) {
+                          RegExpNode* node, uintptr_t stack_limit) {
   Analysis<AssertionPropagator, EatsAtLeastPropagator> analysis(
-      isolate, is_one_byte, flags);
+      isolate, is_one_byte, flags, stack_limit);
   DCHECK_EQ(node->info()->been_analyzed, false);
   analysis.EnsureAnalyzed(node);
   DCHECK_IMPLIES(analysis.has_failed(), analysis.error() != RegExpError::kNone);
@@ -4052,8 +4055,156 @@ RegExpNode* RegExpCompiler::PreprocessRegExp(RegExpCompileData* data,
   return node;
 }
 
+namespace {
+
+// Computes the literal for `RegExpCompiler::FindRequiredLiteral`. For each
+// node, it finds out whether the node always matches the same literal
+// ("exact"), and otherwise the longest literal that all of its matches contain
+// together with its maximal offset from the start of the node's match.
+class RequiredLiteralFinder final {
+ public:
+  explicit RequiredLiteralFinder(Zone* zone) : zone_(zone) {}
+
+  struct Result {
+    bool exact = false;
+    ZoneList<base::uc16>* literal = nullptr;
+    int max_offset = RegExpTree::kInfinity;
+  };
+
+  Result Find(RegExpTree* tree, int depth) {
+    if (depth > RegExpCompiler::kMaxRecursion) return {};
+    if (tree->IsAtom()) {
+      ZoneList<base::uc16>* literal = NewLiteral();
+      literal->AddAll(tree->AsAtom()->data(), zone_);
+      return {true, literal, 0};
+    }
+    if (tree->IsAssertion() || tree->IsLookaround() || tree->IsEmpty()) {
+      // Zero-width, and the body of a lookaround is not part of the match.
+      return {true, NewLiteral(), 0};
+    }
+    if (tree->IsText()) {
+      ZoneList<TextElement>* elements = tree->AsText()->elements();
+      Sequence sequence(this);
+      for (int i = 0; i < elements->length(); i++) {
+        const TextElement& element = elements->at(i);
+        if (element.text_type() == TextElement::ATOM) {
+          sequence.Add(Find(element.atom(), depth + 1), element.tree());
+        } else {
+          sequence.Add({}, element.tree());
+        }
+      }
+      return sequence.Finish();
+    }
+    if (tree->IsAlternative()) {
+      ZoneList<RegExpTree*>* nodes = tree->AsAlternative()->nodes();
+      Sequence sequence(this);
+      for (int i = 0; i < nodes->length(); i++) {
+        sequence.Add(Find(nodes->at(i), depth + 1), nodes->at(i));
+      }
+      return sequence.Finish();
+    }
+    if (tree->IsCapture()) return Find(tree->AsCapture()->body(), depth + 1);
+    if (tree->IsGroup()) {
+      RegExpGroup* group = tree->AsGroup();
+      // Modifiers might make the body case-insensitive.
+      if (IsIgnoreCase(group->flags())) return {};
+      return Find(group->body(), depth + 1);
+    }
+    if (tree->IsQuantifier()) {
+      RegExpQuantifier* quantifier = tree->AsQuantifier();
+      if (quantifier->min() == 0) return {};
+      // The first iteration starts where the quantifier's match starts.
+      Result body = Find(quantifier->body(), depth + 1);
+      if (body.literal == nullptr) return {};
+      return {false, body.literal, body.max_offset};
+    }
+    // Disjunctions, classes and back references.
+    return {};
+  }
+
+ private:
+  // Concatenates consecutive exact nodes, and keeps the longest literal.
+  class Sequence {
+   public:
+    explicit Sequence(RequiredLiteralFinder* finder)
+        : finder_(finder), run_(finder->NewLiteral()) {}
+
+    void Add(Result result, RegExpTree* tree) {
+      if (result.exact) {
+        if (run_->is_empty()) run_offset_ = offset_;
+        run_->AddAll(*result.literal, finder_->zone_);
+      } else {
+        all_exact_ = false;
+        Consider(run_, run_offset_);
+        run_->Rewind(0);
+        if (result.literal != nullptr) {
+          Consider(result.literal, SaturatingAdd(offset_, result.max_offset));
+        }
+      }
+      offset_ = SaturatingAdd(offset_, tree->max_match());
+    }
+
+    Result Finish() {
+      if (all_exact_) return {true, run_, 0};
+      Consider(run_, run_offset_);
+      return {false, best_, best_offset_};
+    }
+
+   private:
+    static int SaturatingAdd(int a, int b) {
+      if (a > RegExpTree::kInfinity - b) return RegExpTree::kInfinity;
+      return a + b;
+    }
+
+    void Consider(ZoneList<base::uc16>* literal, int offset) {
+      if (literal->is_empty()) return;
+      if (best_ != nullptr &&
+          (literal->length() < best_->length() ||
+           (literal->length() == best_->length() && offset >= best_offset_))) {
+        return;
+      }
+      best_ = finder_->NewLiteral();
+      best_->AddAll(*literal, finder_->zone_);
+      best_offset_ = offset;
+    }
+
+    RequiredLiteralFinder* const finder_;
+    // The exact nodes since the last inexact one, concatenated.
+    ZoneList<base::uc16>* const run_;
+    int run_offset_ = 0;
+    // Upper bound on the distance between the start of the sequence's match
+    // and the start of the next node's match.
+    int offset_ = 0;
+    bool all_exact_ = true;
+    ZoneList<base::uc16>* best_ = nullptr;
+    int best_offset_ = RegExpTree::kInfinity;
+  };
+
+  ZoneList<base::uc16>* NewLiteral() {
+    return zone_->New<ZoneList<base::uc16>>(0, zone_);
+  }
+
+  Zone* const zone_;
+};
+
+}  // namespace
+
+// static
+bool RegExpCompiler::FindRequiredLiteral(RegExpTree* tree, RegExpFlags flags,
+                                         Zone* zone,
+                                         ZoneList<base::uc16>* literal,
+                                         int* max_offset) {
+  if (IsIgnoreCase(flags)) return false;
+  RequiredLiteralFinder finder(zone);
+  RequiredLiteralFinder::Result result = finder.Find(tree, 0);
+  if (result.literal == nullptr || result.literal->is_empty()) return false;
+  literal->AddAll(*result.literal, zone);
+  *max_offset = result.max_offset;
+  return true;
+}
+
 void RegExpCompiler::ToNodeCheckForStackOverflow() {
-  if (StackLimitCheck{isolate()}.HasOverflowed()) {
+  if (GetCurrentStackPosition() < stack_limit_) {
     V8::FatalProcessOutOfMemory(isolate(), "RegExpCompiler");
   }
 }
@@ -400,9 +400,10 @@ struct PreloadState {
 
 // Analysis performs assertion propagation and computes eats_at_least_ values.
 // See the comments on AssertionPropagator and EatsAtLeastPropagator for more
-// details.
+// details. Fails with kAnalysisStackOverflow once the stack grows below
+// `stack_limit`.
 RegExpError AnalyzeRegExp(Isolate* isolate, bool is_one_byte, RegExpFlags flags,
-                          RegExpNode* node);
+                          RegExpNode* node, uintptr_t stack_limit);
 
 class FrequencyCollator {
  public:
@@ -510,6 +511,14 @@ class RegExpCompiler {
   // lead surrogate and start matching from there.
   RegExpNode* OptionallyStepBackToLeadSurrogate(RegExpNode* on_success);
 
+  // Finds the longest literal that every match of `tree` contains, by looking
+  // for atoms that can't be skipped. Returns false if there is none. Sets
+  // `max_offset` to an upper bound on the distance between the start of a
+  // match and the literal, or to RegExpTree::kInfinity if there is none.
+  static bool FindRequiredLiteral(RegExpTree* tree, RegExpFlags flags,
+                                  Zone* zone, ZoneList<base::uc16>* literal,
+                                  int* max_offset);
+
   inline void AddWork(RegExpNode* node) {
     if (!node->on_work_list() && !node->label()->is_bound()) {
       node->set_on_work_list(true);
@@ -562,6 +571,11 @@ class RegExpCompiler {
   }
   void ToNodeCheckForStackOverflow();
 
+  // The stack limit for node generation. Defaults to the isolate's, and is
+  // overridden when the compiler runs on a background thread.
+  uintptr_t stack_limit() const { return stack_limit_; }
+  void set_stack_limit(uintptr_t stack_limit) { stack_limit_ = stack_limit; }
+
   Isolate* isolate() const { return isolate_; }
   Zone* zone() const { return zone_; }
 
@@ -586,6 +600,7 @@ class RegExpCompiler {
   FrequencyCollator frequency_collator_;
   Isolate* isolate_;
   Zone* zone_;
+  uintptr_t stack_limit_;
 };
 
 // Categorizes character ranges into BMP, non-BMP, lead, and trail surrogates.
@@ -0,0 +1,198 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/regexp-tier-up-dispatcher.h"
+
+#include <algorithm>
+
+#include "include/v8-platform.h"
+#include "src/execution/isolate.h"
+#include "src/flags/flags.h"
+#include "src/handles/global-handles-inl.h"
+#include "src/init/v8.h"
+#include "src/objects/js-regexp-inl.h"
+#include "src/regexp/regexp-macro-assembler.h"
+#include "src/regexp/regexp-parser.h"
+#include "src/tracing/trace-event.h"
+#include "src/utils/locked-queue-inl.h"
+
+namespace v8 {
+namespace internal {
+
+RegExpTierUpJob::RegExpTierUpJob(Isolate* isolate,
+                                 DirectHandle<IrRegExpData> re_data,
+                                 DirectHandle<String> sample_subject,
+                                 bool is_one_byte, bool optimize)
+    : isolate_(isolate),
+      re_data_location_(
+          isolate->global_handles()->Create(*re_data).location()),
+      flags_(JSRegExp::AsRegExpFlags(re_data->flags())),
+      is_one_byte_(is_one_byte),
+      zone_(isolate->allocator(), ZONE_NAME) {
+  GlobalHandles::MakeWeak(&re_data_location_);
+  DisallowGarbageCollection no_gc;
+  Tagged<String> source = re_data->source();
+  pattern_.resize(source->length());
+  String::WriteToFlat(source, pattern_.data(), 0, source->length());
+
+  // The regexp already compiled to bytecode, so its capture count is valid.
+  DCHECK_LE(JSRegExp::RegistersForCaptureCount(re_data->capture_count()),
+            RegExpMacroAssembler::kMaxRegisterCount);
+  compiler_.emplace(isolate, &zone_, re_data->capture_count(), flags_,
+                    is_one_byte);
+  if (compiler_->optimize()) compiler_->set_optimize(optimize);
+
+  // Sample some characters from the middle of the subject, like
+  // RegExpImpl::Compile does.
+  static const int kSampleSize = 128;
+  Tagged<String> subject = *sample_subject;
+  int chars_sampled = 0;
+  int half_way = (subject->length() - kSampleSize) / 2;
+  for (int i = std::max(0, half_way);
+       i < subject->length() && chars_sampled < kSampleSize;
+       i++, chars_sampled++) {
+    compiler_->frequency_collator()->CountCharacter(subject->Get(i));
+  }
+}
+
+RegExpTierUpJob::~RegExpTierUpJob() {
+  if (re_data_location_ != nullptr) GlobalHandles::Destroy(re_data_location_);
+}
+
+void RegExpTierUpJob::RunFrontEnd() {
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+               "V8.RegExpTierUpFrontEnd");
+  // The isolate's stack limit belongs to the main thread.
+  uintptr_t stack_limit = GetCurrentStackPosition() - v8_flags.stack_size * KB;
+  {
+    DisallowGarbageCollection no_gc;
+    if (!RegExpParser::VerifyRegExpSyntax(
+            &zone_, stack_limit, pattern_.data(),
+            static_cast<int>(pattern_.size()), flags_, &compile_data_, no_gc)) {
+      done_.store(true, std::memory_order_release);
+      return;
+    }
+  }
+
+  compiler_->set_stack_limit(stack_limit);
+  compile_data_.node =
+      compiler_->PreprocessRegExp(&compile_data_, is_one_byte_);
+  compile_data_.error = AnalyzeRegExp(isolate_, is_one_byte_, flags_,
+                                      compile_data_.node, stack_limit);
+  succeeded_ = compile_data_.error == RegExpError::kNone;
+  done_.store(true, std::memory_order_release);
+}
+
+class RegExpTierUpDispatcher::JobTask final : public v8::JobTask {
+ public:
+  explicit JobTask(LockedQueue<RegExpTierUpJob*>* incoming_queue)
+      : incoming_queue_(incoming_queue) {}
+
+  void Run(JobDelegate* delegate) override {
+    while (!delegate->ShouldYield()) {
+      RegExpTierUpJob* job;
+      if (!incoming_queue_->Dequeue(&job)) break;
+      job->RunFrontEnd();
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    return incoming_queue_->size() + worker_count;
+  }
+
+ private:
+  LockedQueue<RegExpTierUpJob*>* const incoming_queue_;
+};
+
+RegExpTierUpDispatcher::RegExpTierUpDispatcher(Isolate* isolate)
+    : isolate_(isolate) {}
+
+RegExpTierUpDispatcher::~RegExpTierUpDispatcher() {
+  if (job_handle_ && job_handle_->IsValid()) {
+    // Wait for running front ends, so that no job is deleted under them.
+    job_handle_->Cancel();
+  }
+}
+
+// static
+bool RegExpTierUpDispatcher::IsEnabled() {
+#ifdef V8_INTL_SUPPORT
+  return v8_flags.regexp_tier_up && v8_flags.regexp_concurrent_tier_up;
+#else
+  // Without ICU, case folding in the front end uses caches on the isolate.
+  return false;
+#endif  // V8_INTL_SUPPORT
+}
+
+void RegExpTierUpDispatcher::DropCollectedJobs() {
+  // Running jobs are still used by a background thread, so only finished ones
+  // can go.
+  std::erase_if(jobs_, [](const std::unique_ptr<RegExpTierUpJob>& job) {
+    return job->is_done() && job->re_data_collected();
+  });
+}
+
+std::unique_ptr<RegExpTierUpJob> RegExpTierUpDispatcher::TakeFinishedJob(
+    Tagged<IrRegExpData> re_data, bool is_one_byte) {
+  DropCollectedJobs();
+  for (auto it = jobs_.begin(); it != jobs_.end(); ++it) {
+    RegExpTierUpJob* job = it->get();
+    if (job->re_data_collected() || job->re_data() != re_data ||
+        job->is_one_byte() != is_one_byte) {
+      continue;
+    }
+    if (!job->is_done()) return {};
+    std::unique_ptr<RegExpTierUpJob> result = std::move(*it);
+    jobs_.erase(it);
+    if (v8_flags.trace_regexp_tier_up) {
+      PrintF("JSRegExp data object %p finished concurrent tier-up front end\n",
+             reinterpret_cast<void*>(re_data.ptr()));
+    }
+    return result;
+  }
+  return {};
+}
+
+bool RegExpTierUpDispatcher::EnsureJobStarted(
+    DirectHandle<IrRegExpData> re_data, DirectHandle<String> sample_subject,
+    bool is_one_byte, bool optimize) {
+  DropCollectedJobs();
+  for (const std::unique_ptr<RegExpTierUpJob>& job : jobs_) {
+    if (!job->re_data_collected() && job->re_data() == *re_data &&
+        job->is_one_byte() == is_one_byte) {
+      return true;
+    }
+  }
+
+  if (jobs_.size() >= kMaxJobs) {
+    // Drop a finished job whose regexp hasn't run since. It is started again
+    // if the regexp runs later.
+    auto it = std::find_if(
+        jobs_.begin(), jobs_.end(),
+        [](const std::unique_ptr<RegExpTierUpJob>& job) {
+          return job->is_done();
+        });
+    if (it == jobs_.end()) return false;
+    jobs_.erase(it);
+  }
+
+  if (v8_flags.trace_regexp_tier_up) {
+    PrintF("JSRegExp data object %p starts concurrent tier-up\n",
+           reinterpret_cast<void*>(re_data->ptr()));
+  }
+  jobs_.push_back(std::make_unique<RegExpTierUpJob>(
+      isolate_, re_data, sample_subject, is_one_byte, optimize));
+  incoming_queue_.Enqueue(jobs_.back().get());
+  if (job_handle_ && job_handle_->IsValid()) {
+    job_handle_->NotifyConcurrencyIncrease();
+  } else {
+    job_handle_ = V8::GetCurrentPlatform()->PostJob(
+        TaskPriority::kUserVisible,
+        std::make_unique<JobTask>(&incoming_queue_));
+  }
+  return true;
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,123 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_REGEXP_TIER_UP_DISPATCHER_H_
+#define V8_REGEXP_REGEXP_TIER_UP_DISPATCHER_H_
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "src/handles/handles.h"
+#include "src/regexp/regexp-compiler.h"
+#include "src/regexp/regexp.h"
+#include "src/utils/locked-queue.h"
+#include "src/zone/zone.h"
+
+namespace v8 {
+
+class JobHandle;
+
+namespace internal {
+
+class IrRegExpData;
+
+// A tier-up compilation of an irregexp to native code. Its front end, i.e.
+// parsing the pattern, building the node graph and analyzing it, doesn't
+// touch the heap and runs on a background thread. Code generation allocates
+// and happens on the main thread once the front end has finished.
+class RegExpTierUpJob final {
+ public:
+  RegExpTierUpJob(Isolate* isolate, DirectHandle<IrRegExpData> re_data,
+                  DirectHandle<String> sample_subject, bool is_one_byte,
+                  bool optimize);
+  ~RegExpTierUpJob();
+  RegExpTierUpJob(const RegExpTierUpJob&) = delete;
+  RegExpTierUpJob& operator=(const RegExpTierUpJob&) = delete;
+
+  // Runs the front end. Called on a background thread. The compiler is set up
+  // on the main thread, since it reads the isolate's stack limit.
+  void RunFrontEnd();
+
+  bool is_done() const { return done_.load(std::memory_order_acquire); }
+
+  // The following must only be used on the main thread.
+  bool succeeded() const {
+    DCHECK(is_done());
+    return succeeded_;
+  }
+  bool is_one_byte() const { return is_one_byte_; }
+  // Whether the regexp data was garbage collected since the job started.
+  bool re_data_collected() const { return re_data_location_ == nullptr; }
+  Tagged<IrRegExpData> re_data() const {
+    DCHECK(!re_data_collected());
+    return Cast<IrRegExpData>(Tagged<Object>(*re_data_location_));
+  }
+  RegExpCompiler* compiler() {
+    DCHECK(succeeded());
+    return &compiler_.value();
+  }
+  RegExpCompileData* compile_data() { return &compile_data_; }
+
+ private:
+  Isolate* const isolate_;
+  // Weak global handle, so that pending and unclaimed finished jobs don't keep
+  // the regexp alive. The GC clears it when the regexp data dies, otherwise
+  // it is destroyed with the job.
+  Address* re_data_location_;
+  const RegExpFlags flags_;
+  const bool is_one_byte_;
+  // A copy of the pattern, which the background thread parses.
+  std::vector<base::uc16> pattern_;
+  Zone zone_;
+  RegExpCompileData compile_data_;
+  std::optional<RegExpCompiler> compiler_;
+  bool succeeded_ = false;
+  std::atomic<bool> done_{false};
+};
+
+// Runs the front ends of regexp tier-up jobs on background threads, while
+// the interpreter keeps matching. The main thread picks finished jobs up the
+// next time it gets to the tier-up of the same regexp.
+class RegExpTierUpDispatcher final {
+ public:
+  explicit RegExpTierUpDispatcher(Isolate* isolate);
+  ~RegExpTierUpDispatcher();
+
+  // Whether regexp tier-up compiles concurrently.
+  static bool IsEnabled();
+
+  // Returns the job for `re_data` and the given encoding if its front end
+  // has finished, and forgets about it.
+  std::unique_ptr<RegExpTierUpJob> TakeFinishedJob(
+      Tagged<IrRegExpData> re_data, bool is_one_byte);
+
+  // Starts a job for `re_data` and the given encoding unless one is already
+  // running. Returns false if too many jobs are in flight, in which case the
+  // caller compiles synchronously.
+  bool EnsureJobStarted(DirectHandle<IrRegExpData> re_data,
+                        DirectHandle<String> sample_subject, bool is_one_byte,
+                        bool optimize);
+
+ private:
+  class JobTask;
+
+  // Deletes finished jobs whose regexp data was garbage collected.
+  void DropCollectedJobs();
+
+  static constexpr size_t kMaxJobs = 8;
+
+  Isolate* const isolate_;
+  // All jobs, owned by the main thread. Background threads only run the ones
+  // they dequeue from `incoming_queue_`, and never delete them.
+  std::vector<std::unique_ptr<RegExpTierUpJob>> jobs_;
+  LockedQueue<RegExpTierUpJob*> incoming_queue_;
+  std::unique_ptr<JobHandle> job_handle_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_REGEXP_TIER_UP_DISPATCHER_H_
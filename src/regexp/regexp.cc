@@ -9,6 +9,7 @@
 #include "src/diagnostics/code-tracer.h"
 #include "src/execution/interrupts-scope.h"
 #include "src/heap/heap-inl.h"
+#include "src/logging/counters.h"
 #include "src/objects/js-regexp-inl.h"
 #include "src/regexp/experimental/experimental.h"
 #include "src/regexp/regexp-bytecode-generator.h"
@@ -19,6 +20,7 @@
 #include "src/regexp/regexp-macro-assembler-arch.h"
 #include "src/regexp/regexp-macro-assembler-tracer.h"
 #include "src/regexp/regexp-parser.h"
+#include "src/regexp/regexp-tier-up-dispatcher.h"
 #include "src/regexp/regexp-utils.h"
 #include "src/strings/string-search.h"
 #include "src/utils/ostreams.h"
@@ -77,6 +79,17 @@ class RegExpImpl final : public AllStatic {
                              Handle<String> subject, int index, int32_t* output,
                              int output_size);
 
+  // Searches the subject for the regexp's required literal. Returns the index
+  // from which matching can start without missing a match, or -1 if there is
+  // no match at or after `index`.
+  static int SkipToRequiredLiteral(Isolate* isolate,
+                                   DirectHandle<IrRegExpData> regexp_data,
+                                   Handle<String> subject, int index);
+  static void SetRequiredLiteral(Isolate* isolate,
+                                 DirectHandle<IrRegExpData> re_data,
+                                 RegExpTree* tree, RegExpFlags flags,
+                                 Zone* zone);
+
   // Execute an Irregexp bytecode pattern.
   // On a successful match, the result is a JSArray containing
   // captured positions.  On a failure, the result is the null value.
@@ -95,11 +108,29 @@ class RegExpImpl final : public AllStatic {
                                             Handle<String> sample_subject,
                                             bool is_one_byte);
 
+  // Installs code or bytecode produced by Compile() on `re_data`.
+  static void InstallCompiledIrregexp(Isolate* isolate,
+                                      DirectHandle<IrRegExpData> re_data,
+                                      RegExpCompileData* compile_data,
+                                      bool is_one_byte,
+                                      uint32_t backtrack_limit);
+  // Generates native code from a tier-up job whose front end has finished on
+  // a background thread, and installs it.
+  static bool FinalizeTierUpJob(Isolate* isolate,
+                                DirectHandle<IrRegExpData> re_data,
+                                RegExpTierUpJob* job);
+
   // Returns true on success, false on failure.
   static bool Compile(Isolate* isolate, Zone* zone, RegExpCompileData* input,
                       RegExpFlags flags, Handle<String> pattern,
                       Handle<String> sample_subject, bool is_one_byte,
                       uint32_t& backtrack_limit);
+  // Generates code for the analyzed node graph in `data`. This is the part of
+  // Compile() that has to run on the main thread.
+  static bool GenerateCode(Isolate* isolate, RegExpCompiler* compiler,
+                           RegExpCompileData* data, RegExpFlags flags,
+                           Handle<String> pattern, bool is_one_byte,
+                           uint32_t& backtrack_limit);
 };
 
 // static
@@ -440,6 +471,27 @@ Handle<Object> RegExpImpl::AtomExec(Isolate* isolate,
 
 // Irregexp implementation.
 
+namespace {
+
+// Returns true if we've either generated too much irregex code within this
+// isolate, or the pattern string is too long.
+bool TooMuchRegExpCode(Isolate* isolate, DirectHandle<String> pattern) {
+  // Limit the space regexps take up on the heap.  In order to limit this we
+  // would like to keep track of the amount of regexp code on the heap.  This
+  // is not tracked, however.  As a conservative approximation we track the
+  // total regexp code compiled including code that has subsequently been freed
+  // and the total executable memory at any point.
+  static constexpr size_t kRegExpExecutableMemoryLimit = 16 * MB;
+  static constexpr size_t kRegExpCompiledLimit = 1 * MB;
+
+  Heap* heap = isolate->heap();
+  if (pattern->length() > RegExp::kRegExpTooLargeToOptimize) return true;
+  return (isolate->total_regexp_code_generated() > kRegExpCompiledLimit &&
+          heap->CommittedMemoryExecutable() > kRegExpExecutableMemoryLimit);
+}
+
+}  // namespace
+
 // Ensures that the regexp object contains a compiled version of the
 // source for either one-byte or two-byte subject strings.
 // If the compiled version doesn't already exist, it is compiled
@@ -470,6 +522,27 @@ bool RegExpImpl::EnsureCompiledIrregexp(Isolate* isolate,
 
   DCHECK_IMPLIES(needs_tier_up_compilation, has_bytecode);
 
+  if (needs_tier_up_compilation && RegExpTierUpDispatcher::IsEnabled()) {
+    RegExpTierUpDispatcher* dispatcher = isolate->regexp_tier_up_dispatcher();
+    std::unique_ptr<RegExpTierUpJob> job =
+        dispatcher->TakeFinishedJob(*re_data, is_one_byte);
+    if (job) {
+      // A failed front end is redone synchronously to report the error.
+      if (job->succeeded()) {
+        return FinalizeTierUpJob(isolate, re_data, job.get());
+      }
+    } else if (dispatcher->EnsureJobStarted(
+                   re_data, sample_subject, is_one_byte,
+                   !TooMuchRegExpCode(isolate,
+                                      handle(re_data->source(), isolate)))) {
+      // Keep interpreting until the background job has finished. The
+      // interpreter re-enters the runtime, and thus gets here, once the
+      // regexp is marked for tier-up again.
+      re_data->ResetLastTierUpTick();
+      return true;
+    }
+  }
+
   return CompileIrregexp(isolate, re_data, sample_subject, is_one_byte);
 }
 
@@ -559,6 +632,11 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate,
                                      compile_data.error));
     return false;
   }
+  Tagged<Object> required_literal = re_data->required_literal();
+  if (IsSmi(required_literal) &&
+      Smi::ToInt(required_literal) == JSRegExp::kUninitializedValue) {
+    SetRequiredLiteral(isolate, re_data, compile_data.tree, flags, &zone);
+  }
   // The compilation target is a kBytecode if we're interpreting all regexp
   // objects, or if we're using the tier-up strategy but the tier-up hasn't
   // happened yet. The compilation target is a kNative if we're using the
@@ -577,29 +655,40 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate,
     return false;
   }
 
-  if (compile_data.compilation_target == RegExpCompilationTarget::kNative) {
-    re_data->set_code(is_one_byte, Cast<Code>(*compile_data.code));
+  InstallCompiledIrregexp(isolate, re_data, &compile_data, is_one_byte,
+                          backtrack_limit);
+  return true;
+}
+
+// static
+void RegExpImpl::InstallCompiledIrregexp(Isolate* isolate,
+                                         DirectHandle<IrRegExpData> re_data,
+                                         RegExpCompileData* compile_data,
+                                         bool is_one_byte,
+                                         uint32_t backtrack_limit) {
+  if (compile_data->compilation_target == RegExpCompilationTarget::kNative) {
+    re_data->set_code(is_one_byte, Cast<Code>(*compile_data->code));
 
     // Reset bytecode to uninitialized. In case we use tier-up we know that
     // tier-up has happened this way.
     re_data->clear_bytecode(is_one_byte);
   } else {
-    DCHECK_EQ(compile_data.compilation_target,
+    DCHECK_EQ(compile_data->compilation_target,
               RegExpCompilationTarget::kBytecode);
     // Store code generated by compiler in bytecode and trampoline to
     // interpreter in code.
     re_data->set_bytecode(is_one_byte,
-                          Cast<TrustedByteArray>(*compile_data.code));
+                          Cast<TrustedByteArray>(*compile_data->code));
     DirectHandle<Code> trampoline =
         BUILTIN_CODE(isolate, RegExpInterpreterTrampoline);
     re_data->set_code(is_one_byte, *trampoline);
   }
   Handle<FixedArray> capture_name_map =
-      RegExp::CreateCaptureNameMap(isolate, compile_data.named_captures);
+      RegExp::CreateCaptureNameMap(isolate, compile_data->named_captures);
   re_data->set_capture_name_map(capture_name_map);
   int register_max = re_data->max_register_count();
-  if (compile_data.register_count > register_max) {
-    re_data->set_max_register_count(compile_data.register_count);
+  if (compile_data->register_count > register_max) {
+    re_data->set_max_register_count(compile_data->register_count);
   }
   re_data->set_backtrack_limit(backtrack_limit);
 
@@ -611,7 +700,31 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate,
                ? re_data->bytecode(is_one_byte)->AllocatedSize()
                : re_data->code(isolate, is_one_byte)->Size());
   }
+}
+
+// static
+bool RegExpImpl::FinalizeTierUpJob(Isolate* isolate,
+                                   DirectHandle<IrRegExpData> re_data,
+                                   RegExpTierUpJob* job) {
+  DCHECK(job->succeeded());
+  DCHECK(re_data->MarkedForTierUp());
+  PostponeInterruptsScope postpone(isolate);
+
+  RegExpFlags flags = JSRegExp::AsRegExpFlags(re_data->flags());
+  Handle<String> pattern(re_data->source(), isolate);
+  pattern = String::Flatten(isolate, pattern);
+  RegExpCompileData* compile_data = job->compile_data();
+  compile_data->compilation_target = RegExpCompilationTarget::kNative;
+  uint32_t backtrack_limit = re_data->backtrack_limit();
+  if (!GenerateCode(isolate, job->compiler(), compile_data, flags, pattern,
+                    job->is_one_byte(), backtrack_limit)) {
+    DCHECK(compile_data->error != RegExpError::kNone);
+    RegExp::ThrowRegExpException(isolate, re_data, compile_data->error);
+    return false;
+  }
 
+  InstallCompiledIrregexp(isolate, re_data, compile_data, job->is_one_byte(),
+                          backtrack_limit);
   return true;
 }
 
@@ -653,11 +766,18 @@ int RegExpImpl::IrregexpExecRaw(Isolate* isolate,
   DCHECK_GE(output_size,
             JSRegExp::RegistersForCaptureCount(regexp_data->capture_count()));
 
+  if (v8_flags.regexp_required_literal_prefilter) {
+    index = SkipToRequiredLiteral(isolate, regexp_data, subject, index);
+    if (index < 0) return RegExp::RE_FAILURE;
+  }
+
   bool is_one_byte = String::IsOneByteRepresentationUnderneath(*subject);
 
   if (!regexp_data->ShouldProduceBytecode()) {
     do {
       EnsureCompiledIrregexp(isolate, regexp_data, subject, is_one_byte);
+      // A concurrent tier-up that hasn't finished yet keeps interpreting.
+      if (regexp_data->ShouldProduceBytecode()) break;
       // The stack is used to allocate registers for the compiled regexp code.
       // This means that in case of failure, the output registers array is left
       // untouched and contains the capture results from the previous successful
@@ -683,35 +803,87 @@ int RegExpImpl::IrregexpExecRaw(Isolate* isolate,
       // UC16, but the characters are always the same).
       is_one_byte = String::IsOneByteRepresentationUnderneath(*subject);
     } while (true);
-    UNREACHABLE();
-  } else {
-    DCHECK(regexp_data->ShouldProduceBytecode());
+  }
 
-    do {
-      IrregexpInterpreter::Result result =
-          IrregexpInterpreter::MatchForCallFromRuntime(
-              isolate, regexp_data, subject, output, output_size, index);
-      DCHECK_IMPLIES(result == IrregexpInterpreter::EXCEPTION,
-                     isolate->has_exception());
-
-      switch (result) {
-        case IrregexpInterpreter::SUCCESS:
-        case IrregexpInterpreter::EXCEPTION:
-        case IrregexpInterpreter::FAILURE:
-        case IrregexpInterpreter::FALLBACK_TO_EXPERIMENTAL:
-          return result;
-        case IrregexpInterpreter::RETRY:
-          // The string has changed representation, and we must restart the
-          // match.
-          // We need to reset the tier up to start over with compilation.
-          if (v8_flags.regexp_tier_up) regexp_data->ResetLastTierUpTick();
-          is_one_byte = String::IsOneByteRepresentationUnderneath(*subject);
-          EnsureCompiledIrregexp(isolate, regexp_data, subject, is_one_byte);
-          break;
-      }
-    } while (true);
-    UNREACHABLE();
+  DCHECK(regexp_data->ShouldProduceBytecode());
+  do {
+    IrregexpInterpreter::Result result =
+        IrregexpInterpreter::MatchForCallFromRuntime(
+            isolate, regexp_data, subject, output, output_size, index);
+    DCHECK_IMPLIES(result == IrregexpInterpreter::EXCEPTION,
+                   isolate->has_exception());
+
+    switch (result) {
+      case IrregexpInterpreter::SUCCESS:
+      case IrregexpInterpreter::EXCEPTION:
+      case IrregexpInterpreter::FAILURE:
+      case IrregexpInterpreter::FALLBACK_TO_EXPERIMENTAL:
+        return result;
+      case IrregexpInterpreter::RETRY:
+        // The string has changed representation, and we must restart the
+        // match.
+        // We need to reset the tier up to start over with compilation.
+        if (v8_flags.regexp_tier_up) regexp_data->ResetLastTierUpTick();
+        is_one_byte = String::IsOneByteRepresentationUnderneath(*subject);
+        EnsureCompiledIrregexp(isolate, regexp_data, subject, is_one_byte);
+        break;
+    }
+  } while (true);
+  UNREACHABLE();
+}
+
+// static
+void RegExpImpl::SetRequiredLiteral(Isolate* isolate,
+                                    DirectHandle<IrRegExpData> re_data,
+                                    RegExpTree* tree, RegExpFlags flags,
+                                    Zone* zone) {
+  // Only record a literal if the prefilter can move the start of the match
+  // forward. Otherwise the search for it costs time proportional to the rest
+  // of the subject on every run, even when the matcher would fail right away:
+  // sticky and start-anchored regexps can only match at the start index, and
+  // in unicode mode, skipping might start the match within a surrogate pair.
+  // The same holds if the literal can be arbitrarily far from the start of
+  // the match.
+  ZoneList<base::uc16> literal(0, zone);
+  int max_offset;
+  if (IsSticky(flags) || IsEitherUnicode(flags) ||
+      tree->IsAnchoredAtStart() ||
+      !RegExpCompiler::FindRequiredLiteral(tree, flags, zone, &literal,
+                                           &max_offset) ||
+      max_offset == RegExpTree::kInfinity) {
+    re_data->set_required_literal(Smi::zero());
+    return;
+  }
+  // The offset is stored as a Smi.
+  if (max_offset > Smi::kMaxValue) {
+    re_data->set_required_literal(Smi::zero());
+    return;
   }
+  DirectHandle<String> literal_string =
+      isolate->factory()
+          ->NewStringFromTwoByte(literal.ToConstVector())
+          .ToHandleChecked();
+  re_data->set_required_literal(*literal_string);
+  re_data->set_required_literal_max_offset(max_offset);
+}
+
+// static
+int RegExpImpl::SkipToRequiredLiteral(Isolate* isolate,
+                                      DirectHandle<IrRegExpData> regexp_data,
+                                      Handle<String> subject, int index) {
+  Tagged<Object> required_literal = regexp_data->required_literal();
+  if (!IsString(required_literal)) return index;
+
+  // String::IndexOf looks for the first character with memchr.
+  Handle<String> literal(Cast<String>(required_literal), isolate);
+  int position = String::IndexOf(isolate, subject, literal, index);
+  if (position < 0) return -1;
+
+  DCHECK(!IsSticky(JSRegExp::AsRegExpFlags(regexp_data->flags())));
+  DCHECK(!IsEitherUnicode(JSRegExp::AsRegExpFlags(regexp_data->flags())));
+  int max_offset = regexp_data->required_literal_max_offset();
+  DCHECK_LE(0, max_offset);
+  return std::max(index, position - max_offset);
 }
 
 MaybeHandle<Object> RegExpImpl::IrregexpExec(
@@ -824,27 +996,6 @@ void RegExp::DotPrintForTesting(const char* label, RegExpNode* node) {
   DotPrinter::DotPrint(label, node);
 }
 
-namespace {
-
-// Returns true if we've either generated too much irregex code within this
-// isolate, or the pattern string is too long.
-bool TooMuchRegExpCode(Isolate* isolate, DirectHandle<String> pattern) {
-  // Limit the space regexps take up on the heap.  In order to limit this we
-  // would like to keep track of the amount of regexp code on the heap.  This
-  // is not tracked, however.  As a conservative approximation we track the
-  // total regexp code compiled including code that has subsequently been freed
-  // and the total executable memory at any point.
-  static constexpr size_t kRegExpExecutableMemoryLimit = 16 * MB;
-  static constexpr size_t kRegExpCompiledLimit = 1 * MB;
-
-  Heap* heap = isolate->heap();
-  if (pattern->length() > RegExp::kRegExpTooLargeToOptimize) return true;
-  return (isolate->total_regexp_code_generated() > kRegExpCompiledLimit &&
-          heap->CommittedMemoryExecutable() > kRegExpExecutableMemoryLimit);
-}
-
-}  // namespace
-
 // static
 bool RegExp::CompileForTesting(Isolate* isolate, Zone* zone,
                                RegExpCompileData* data, RegExpFlags flags,
@@ -886,11 +1037,21 @@ bool RegExpImpl::Compile(Isolate* isolate, Zone* zone, RegExpCompileData* data,
   }
 
   data->node = compiler.PreprocessRegExp(data, is_one_byte);
-  data->error = AnalyzeRegExp(isolate, is_one_byte, flags, data->node);
+  data->error = AnalyzeRegExp(isolate, is_one_byte, flags, data->node,
+                              compiler.stack_limit());
   if (data->error != RegExpError::kNone) {
     return false;
   }
 
+  return GenerateCode(isolate, &compiler, data, flags, pattern, is_one_byte,
+                      backtrack_limit);
+}
+
+bool RegExpImpl::GenerateCode(Isolate* isolate, RegExpCompiler* compiler,
+                              RegExpCompileData* data, RegExpFlags flags,
+                              Handle<String> pattern, bool is_one_byte,
+                              uint32_t& backtrack_limit) {
+  Zone* zone = compiler->zone();
   if (v8_flags.trace_regexp_graph) DotPrinter::DotPrint("Start", data->node);
 
   // Create the correct assembler for the architecture.
@@ -992,7 +1153,7 @@ bool RegExpImpl::Compile(Isolate* isolate, Zone* zone, RegExpCompileData* data,
   }
 #endif
 
-  RegExpCompiler::CompilationResult result = compiler.Assemble(
+  RegExpCompiler::CompilationResult result = compiler->Assemble(
       isolate, macro_assembler_ptr, data->node, data->capture_count, pattern);
 
   // Code / bytecode printing.
@@ -1039,6 +1200,10 @@ RegExpGlobalCache::RegExpGlobalCache(Handle<RegExpData> regexp_data,
       isolate_(isolate) {
   DCHECK(IsGlobal(JSRegExp::AsRegExpFlags(regexp_data->flags())));
 
+  if (v8_flags.regexp_global_results_cache && ReplayFromResultsCache()) {
+    return;
+  }
+
   switch (regexp_data_->type_tag()) {
     case RegExpData::Type::ATOM: {
       // ATOM regexps do not have a global loop, so we search for one match at
@@ -1111,6 +1276,70 @@ RegExpGlobalCache::~RegExpGlobalCache() {
   }
 }
 
+bool RegExpGlobalCache::ReplayFromResultsCache() {
+  Tagged<FixedArray> last_match_cache;
+  Tagged<Object> cached = RegExpResultsCache::Lookup(
+      isolate_->heap(), *subject_, regexp_data_->wrapper(), &last_match_cache,
+      RegExpResultsCache::REGEXP_GLOBAL_MATCHES);
+  if (!IsFixedArray(cached)) {
+    isolate_->counters()->regexp_global_cache_misses()->Increment();
+    if (v8_flags.trace_regexp_global_results_cache) {
+      PrintF("[regexp global results cache] miss, subject length %d\n",
+             subject_->length());
+    }
+    // Record the matches so that the caller can enter them afterwards.
+    recording_ = true;
+    return false;
+  }
+
+  isolate_->counters()->regexp_global_cache_hits()->Increment();
+  Tagged<FixedArray> registers = Cast<FixedArray>(cached);
+  registers_per_match_ =
+      JSRegExp::RegistersForCaptureCount(regexp_data_->capture_count());
+  register_array_size_ = registers->length();
+  DCHECK_EQ(0, register_array_size_ % registers_per_match_);
+  if (v8_flags.trace_regexp_global_results_cache) {
+    PrintF("[regexp global results cache] hit, %d matches\n",
+           register_array_size_ / registers_per_match_);
+  }
+
+  if (register_array_size_ > Isolate::kJSRegexpStaticOffsetsVectorSize) {
+    register_array_ = NewArray<int32_t>(register_array_size_);
+  } else {
+    register_array_ = isolate_->jsregexp_static_offsets_vector();
+  }
+  for (int i = 0; i < register_array_size_; i++) {
+    register_array_[i] = Smi::ToInt(registers->get(i));
+  }
+
+  // All matches form a single batch that isn't fully filled, so FetchNext()
+  // returns them one by one and then fails without running the regexp.
+  num_matches_ = register_array_size_ / registers_per_match_;
+  max_matches_ = num_matches_ + 1;
+  current_match_index_ = -1;
+  return true;
+}
+
+void RegExpGlobalCache::EnterResultsCache() {
+  DCHECK(!HasException());
+  DCHECK_EQ(0, num_matches_);
+  // Global regexps without any match are cheap to rerun and can't be stored,
+  // since the empty fixed array can't be turned into a COW array.
+  if (!recording_ || recorded_registers_.empty()) return;
+  recording_ = false;
+
+  Factory* factory = isolate_->factory();
+  int length = static_cast<int>(recorded_registers_.size());
+  DirectHandle<FixedArray> registers = factory->NewFixedArray(length);
+  for (int i = 0; i < length; i++) {
+    registers->set(i, Smi::FromInt(recorded_registers_[i]));
+  }
+  RegExpResultsCache::Enter(isolate_, subject_,
+                            handle(regexp_data_->wrapper(), isolate_),
+                            registers, factory->empty_fixed_array(),
+                            RegExpResultsCache::REGEXP_GLOBAL_MATCHES);
+}
+
 int RegExpGlobalCache::AdvanceZeroLength(int last_index) {
   if (IsEitherUnicode(JSRegExp::AsRegExpFlags(regexp_data_->flags())) &&
       last_index + 1 < subject_->length() &&
@@ -1188,6 +1417,18 @@ int32_t* RegExpGlobalCache::FetchNext() {
     // that current_match_index * registers_per_match_ < register_array_size_.
     SBXCHECK_LE(num_matches_, max_matches_);
 
+    if (recording_) {
+      size_t count = static_cast<size_t>(num_matches_ * registers_per_match_);
+      if (recorded_registers_.size() + count > kMaxCachedRegisters) {
+        // Too many matches to be worth caching.
+        recording_ = false;
+        recorded_registers_.clear();
+      } else {
+        recorded_registers_.insert(recorded_registers_.end(), register_array_,
+                                   register_array_ + count);
+      }
+    }
+
     current_match_index_ = 0;
     return register_array_;
   } else {
@@ -1209,28 +1450,39 @@ Tagged<Object> RegExpResultsCache::Lookup(Heap* heap, Tagged<String> key_string,
                                           Tagged<FixedArray>* last_match_cache,
                                           ResultsCacheType type) {
   Tagged<FixedArray> cache;
-  if (!IsInternalizedString(key_string)) return Smi::zero();
-  if (type == STRING_SPLIT_SUBSTRINGS) {
-    DCHECK(IsString(key_pattern));
-    if (!IsInternalizedString(key_pattern)) return Smi::zero();
-    cache = heap->string_split_cache();
-  } else {
-    DCHECK(type == REGEXP_MULTIPLE_INDICES);
+  if (type == REGEXP_GLOBAL_MATCHES) {
     DCHECK(IsRegExpDataWrapper(key_pattern));
-    cache = heap->regexp_multiple_cache();
+    cache = heap->regexp_global_matches_cache();
+  } else {
+    if (!IsInternalizedString(key_string)) return Smi::zero();
+    if (type == STRING_SPLIT_SUBSTRINGS) {
+      DCHECK(IsString(key_pattern));
+      if (!IsInternalizedString(key_pattern)) return Smi::zero();
+      cache = heap->string_split_cache();
+    } else {
+      DCHECK(type == REGEXP_MULTIPLE_INDICES);
+      DCHECK(IsRegExpDataWrapper(key_pattern));
+      cache = heap->regexp_multiple_cache();
+    }
   }
 
-  uint32_t hash = key_string->hash();
+  // Subjects of global matches are usually built at runtime, so they are
+  // compared by content rather than by identity.
+  auto matches = [=](uint32_t index) {
+    if (cache->get(index + kPatternOffset) != key_pattern) return false;
+    Tagged<Object> string = cache->get(index + kStringOffset);
+    if (string == key_string) return true;
+    return type == REGEXP_GLOBAL_MATCHES && IsString(string) &&
+           Cast<String>(string)->Equals(key_string);
+  };
+
+  uint32_t hash = key_string->EnsureHash();
   uint32_t index = ((hash & (kRegExpResultsCacheSize - 1)) &
                     ~(kArrayEntriesPerCacheEntry - 1));
-  if (cache->get(index + kStringOffset) != key_string ||
-      cache->get(index + kPatternOffset) != key_pattern) {
+  if (!matches(index)) {
     index =
         ((index + kArrayEntriesPerCacheEntry) & (kRegExpResultsCacheSize - 1));
-    if (cache->get(index + kStringOffset) != key_string ||
-        cache->get(index + kPatternOffset) != key_pattern) {
-      return Smi::zero();
-    }
+    if (!matches(index)) return Smi::zero();
   }
 
   *last_match_cache = Cast<FixedArray>(cache->get(index + kLastMatchOffset));
@@ -1245,18 +1497,23 @@ void RegExpResultsCache::Enter(Isolate* isolate,
                                ResultsCacheType type) {
   Factory* factory = isolate->factory();
   DirectHandle<FixedArray> cache;
-  if (!IsInternalizedString(*key_string)) return;
-  if (type == STRING_SPLIT_SUBSTRINGS) {
-    DCHECK(IsString(*key_pattern));
-    if (!IsInternalizedString(*key_pattern)) return;
-    cache = factory->string_split_cache();
-  } else {
-    DCHECK(type == REGEXP_MULTIPLE_INDICES);
+  if (type == REGEXP_GLOBAL_MATCHES) {
     DCHECK(IsRegExpDataWrapper(*key_pattern));
-    cache = factory->regexp_multiple_cache();
+    cache = factory->regexp_global_matches_cache();
+  } else {
+    if (!IsInternalizedString(*key_string)) return;
+    if (type == STRING_SPLIT_SUBSTRINGS) {
+      DCHECK(IsString(*key_pattern));
+      if (!IsInternalizedString(*key_pattern)) return;
+      cache = factory->string_split_cache();
+    } else {
+      DCHECK(type == REGEXP_MULTIPLE_INDICES);
+      DCHECK(IsRegExpDataWrapper(*key_pattern));
+      cache = factory->regexp_multiple_cache();
+    }
   }
 
-  uint32_t hash = key_string->hash();
+  uint32_t hash = key_string->EnsureHash();
   uint32_t index = ((hash & (kRegExpResultsCacheSize - 1)) &
                     ~(kArrayEntriesPerCacheEntry - 1));
   if (cache->get(index + kStringOffset) == Smi::zero()) {
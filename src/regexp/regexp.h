@@ -5,6 +5,8 @@
 #ifndef V8_REGEXP_REGEXP_H_
 #define V8_REGEXP_REGEXP_H_
 
+#include <vector>
+
 #include "src/common/assert-scope.h"
 #include "src/handles/handles.h"
 #include "src/regexp/regexp-error.h"
@@ -194,8 +196,18 @@ class RegExpGlobalCache final {
 
   bool HasException() { return num_matches_ < 0; }
 
+  // Stores all matches fetched so far in the global matches results cache,
+  // so that the next global cache for the same regexp and subject replays
+  // them instead of running the regexp again. Must only be called after
+  // FetchNext() returned nullptr without an exception.
+  void EnterResultsCache();
+
  private:
+  // The maximum number of registers stored per cache entry.
+  static constexpr size_t kMaxCachedRegisters = 4096;
+
   int AdvanceZeroLength(int last_index);
+  bool ReplayFromResultsCache();
 
   int num_matches_;
   int max_matches_;
@@ -207,6 +219,9 @@ class RegExpGlobalCache final {
   Handle<RegExpData> regexp_data_;
   Handle<String> subject_;
   Isolate* isolate_;
+  // Registers of all matches so far, recorded on a results cache miss.
+  std::vector<int32_t> recorded_registers_;
+  bool recording_ = false;
 };
 
 // Caches results for specific regexp queries on the isolate. At the time of
@@ -214,7 +229,13 @@ class RegExpGlobalCache final {
 // @@split.
 class RegExpResultsCache final : public AllStatic {
  public:
-  enum ResultsCacheType { REGEXP_MULTIPLE_INDICES, STRING_SPLIT_SUBSTRINGS };
+  // REGEXP_GLOBAL_MATCHES caches the match registers of global regexps and,
+  // unlike the other types, also accepts non-internalized subject strings.
+  enum ResultsCacheType {
+    REGEXP_MULTIPLE_INDICES,
+    STRING_SPLIT_SUBSTRINGS,
+    REGEXP_GLOBAL_MATCHES
+  };
 
   // Attempt to retrieve a cached result.  On failure, 0 is returned as a Smi.
   // On success, the returned result is guaranteed to be a COW-array.
@@ -713,6 +713,7 @@ V8_WARN_UNUSED_RESULT static Tagged<Object> StringReplaceGlobalRegExpWithString(
   } while (current_match != nullptr);
 
   if (global_cache.HasException()) return ReadOnlyRoots(isolate).exception();
+  global_cache.EnterResultsCache();
 
   if (prev < subject_length) {
     builder.AddSubjectSlice(prev, subject_length);
@@ -1362,6 +1363,7 @@ static Tagged<Object> SearchRegExpMultiple(
   }
 
   if (global_cache.HasException()) return ReadOnlyRoots(isolate).exception();
+  global_cache.EnterResultsCache();
 
   if (match_start >= 0) {
     // Finished matching, with at least one match.
@@ -5,7 +5,11 @@
 #include "src/snapshot/code-serializer.h"
 
 #include <memory>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
+#include "src/base/functional.h"
 #include "src/base/logging.h"
 #include "src/base/platform/elapsed-timer.h"
 #include "src/base/platform/platform.h"
@@ -20,7 +24,7 @@
 #include "src/logging/log.h"
 #include "src/logging/runtime-call-stats-scope.h"
 #include "src/objects/objects-inl.h"
-#include "src/objects/shared-function-info.h"
+#include "src/objects/shared-function-info-inl.h"
 #include "src/objects/slots.h"
 #include "src/objects/visitors.h"
 #include "src/snapshot/object-deserializer.h"
@@ -46,9 +50,84 @@ CodeSerializer::CodeSerializer(Isolate* isolate, uint32_t source_hash)
     : Serializer(isolate, Snapshot::kDefaultSerializerFlags),
       source_hash_(source_hash) {}
 
+namespace {
+
+// Returns whether |sfi| can be serialized as if its bytecode had been flushed.
+// Only plain bytecode is replaced; baseline code, interpreter data and debug
+// bytecode are left alone.
+bool CanSerializeAsUncompiled(Isolate* isolate,
+                              Tagged<SharedFunctionInfo> sfi) {
+  if (sfi->is_toplevel()) return false;
+  if (!IsBytecodeArray(sfi->GetTrustedData(isolate))) return false;
+  return !sfi->HasDebugInfo(isolate);
+}
+
+// Returns the start positions of the functions that were lazily compiled since
+// |script| was compiled or deserialized, or since the last code cache was
+// created for it (serializing a Script clears the list, see
+// Serializer::ObjectSerializer::Serialize).
+std::unordered_set<int> LazilyCompiledFunctionPositions(
+    Isolate* isolate, Tagged<Script> script) {
+  std::unordered_set<int> positions;
+  Tagged<Object> maybe_list = script->compiled_lazy_function_positions();
+  if (IsUndefined(maybe_list, isolate)) return positions;
+  Tagged<ArrayList> list = Cast<ArrayList>(maybe_list);
+  for (int i = 0; i < list->length(); ++i) {
+    positions.insert(Smi::ToInt(list->get(i)));
+  }
+  return positions;
+}
+
+std::vector<std::pair<Handle<SharedFunctionInfo>, Handle<UncompiledData>>>
+CreateUncompiledReplacements(Isolate* isolate, DirectHandle<Script> script,
+                             CodeSerializer::SerializeMode mode) {
+  std::vector<Handle<SharedFunctionInfo>> replaced_functions;
+  {
+    DisallowGarbageCollection no_gc;
+    std::unordered_set<int> delta_positions;
+    const base::EnumSet<CodeFlushMode> code_flush_mode =
+        Heap::GetCodeFlushMode(isolate);
+    if (mode == CodeSerializer::SerializeMode::kDelta) {
+      delta_positions = LazilyCompiledFunctionPositions(isolate, *script);
+    }
+    SharedFunctionInfo::ScriptIterator iter(isolate, *script);
+    for (Tagged<SharedFunctionInfo> info = iter.Next(); !info.is_null();
+         info = iter.Next()) {
+      if (!CanSerializeAsUncompiled(isolate, info)) continue;
+      bool replace;
+      if (mode == CodeSerializer::SerializeMode::kDelta) {
+        // Everything that isn't new is already part of the base cache.
+        replace = delta_positions.count(info->StartPosition()) == 0;
+      } else {
+        // Bytecode that the GC would flush anyway only costs cache size and
+        // deserialization time.
+        replace = v8_flags.code_cache_skip_old_bytecode &&
+                  info->ShouldFlushCode(isolate, code_flush_mode,
+                                        isolate->is_backgrounded());
+      }
+      if (replace) replaced_functions.push_back(handle(info, isolate));
+    }
+  }
+
+  // Must happen after the iteration since creating UncompiledData allocates.
+  std::vector<std::pair<Handle<SharedFunctionInfo>, Handle<UncompiledData>>>
+      result;
+  result.reserve(replaced_functions.size());
+  for (Handle<SharedFunctionInfo> sfi : replaced_functions) {
+    Handle<UncompiledData> data =
+        isolate->factory()->NewUncompiledDataWithoutPreparseData(
+            handle(sfi->inferred_name(), isolate), sfi->StartPosition(),
+            sfi->EndPosition());
+    result.emplace_back(sfi, data);
+  }
+  return result;
+}
+
+}  // namespace
+
 // static
 ScriptCompiler::CachedData* CodeSerializer::Serialize(
-    Isolate* isolate, Handle<SharedFunctionInfo> info) {
+    Isolate* isolate, Handle<SharedFunctionInfo> info, SerializeMode mode) {
   TRACE_EVENT_CALL_STATS_SCOPED(isolate, "v8", "V8.Execute");
   NestedTimedHistogramScope histogram_timer(
       isolate->counters()->compile_serialize());
@@ -68,13 +147,35 @@ ScriptCompiler::CachedData* CodeSerializer::Serialize(
   // context independent.
   if (script->ContainsAsmModule()) return nullptr;
 #endif  // V8_ENABLE_WEBASSEMBLY
+  // Without the list of lazily compiled functions there is no way to tell
+  // which functions are new.
+  if (mode == SerializeMode::kDelta && !script->produce_compile_hints()) {
+    return nullptr;
+  }
 
   // Serialize code object.
   DirectHandle<String> source(Cast<String>(script->source()), isolate);
   HandleScope scope(isolate);
-  CodeSerializer cs(isolate, SerializedCodeData::SourceHash(
-                                 source, script->origin_options()));
+  // Functions with old bytecode (or, for a delta, functions that are already
+  // in the base cache) are serialized as uncompiled, so that loading the cache
+  // only materializes the bytecode that is needed. The others are compiled
+  // through the lazy compile path on first call.
+  std::vector<std::pair<Handle<SharedFunctionInfo>, Handle<UncompiledData>>>
+      uncompiled_replacements;
+  if (mode == SerializeMode::kDelta || v8_flags.code_cache_skip_old_bytecode) {
+    uncompiled_replacements =
+        CreateUncompiledReplacements(isolate, script, mode);
+  }
+  const uint32_t source_hash =
+      mode == SerializeMode::kDelta
+          ? SerializedCodeData::DeltaSourceHash(
+                isolate, handle(*source, isolate), script->origin_options())
+          : SerializedCodeData::SourceHash(source, script->origin_options());
+  CodeSerializer cs(isolate, source_hash);
   DisallowGarbageCollection no_gc;
+  for (const auto& [sfi, uncompiled_data] : uncompiled_replacements) {
+    cs.AddUncompiledReplacement(sfi, uncompiled_data);
+  }
   cs.reference_map()->AddAttachedReference(*source);
   AlignedCachedData* cached_data = cs.SerializeSharedFunctionInfo(info);
 
@@ -107,6 +208,13 @@ AlignedCachedData* CodeSerializer::SerializeSharedFunctionInfo(
   return data.GetScriptData();
 }
 
+void CodeSerializer::AddUncompiledReplacement(
+    DirectHandle<SharedFunctionInfo> sfi,
+    Handle<UncompiledData> uncompiled_data) {
+  DCHECK(CanSerializeAsUncompiled(isolate(), *sfi));
+  uncompiled_replacements_.emplace(sfi->address(), uncompiled_data);
+}
+
 void CodeSerializer::SerializeObjectImpl(Handle<HeapObject> obj,
                                          SlotType slot_type) {
   ReadOnlyRoots roots(isolate());
@@ -159,6 +267,8 @@ void CodeSerializer::SerializeObjectImpl(Handle<HeapObject> obj,
     DirectHandle<DebugInfo> debug_info;
     CachedTieringDecision cached_tiering_decision;
     bool restore_bytecode = false;
+    Tagged<BytecodeArray> replaced_bytecode;
+    Tagged<HeapObject> replaced_feedback_metadata;
     {
       DisallowGarbageCollection no_gc;
       Tagged<SharedFunctionInfo> sfi = Cast<SharedFunctionInfo>(*obj);
@@ -169,6 +279,21 @@ void CodeSerializer::SerializeObjectImpl(Handle<HeapObject> obj,
       DCHECK(!sfi->HasAsmWasmData());
 #endif  // V8_ENABLE_WEBASSEMBLY
 
+      auto replacement = uncompiled_replacements_.find(sfi.address());
+      if (replacement != uncompiled_replacements_.end()) {
+        // Temporarily put the function into the same state as after bytecode
+        // flushing (see SharedFunctionInfo::DiscardCompiled).
+        replaced_bytecode = sfi->GetBytecodeArray(isolate());
+        replaced_feedback_metadata =
+            sfi->raw_outer_scope_info_or_feedback_metadata();
+        Tagged<HeapObject> outer_scope_info =
+            sfi->scope_info()->HasOuterScopeInfo()
+                ? Tagged<HeapObject>(sfi->scope_info()->OuterScopeInfo())
+                : Tagged<HeapObject>(roots.the_hole_value());
+        sfi->set_raw_outer_scope_info_or_feedback_metadata(outer_scope_info);
+        sfi->SetTrustedData(*replacement->second);
+      }
+
       if (auto maybe_debug_info = sfi->TryGetDebugInfo(isolate())) {
         debug_info = handle(maybe_debug_info.value(), isolate());
         // Clear debug info.
@@ -193,6 +318,11 @@ void CodeSerializer::SerializeObjectImpl(Handle<HeapObject> obj,
       sfi->SetActiveBytecodeArray(debug_info->DebugBytecodeArray(isolate()),
                                   isolate());
     }
+    if (!replaced_bytecode.is_null()) {
+      sfi->set_raw_outer_scope_info_or_feedback_metadata(
+          replaced_feedback_metadata);
+      sfi->SetTrustedData(replaced_bytecode);
+    }
     if (v8_flags.profile_guided_optimization &&
         cached_tiering_decision > CachedTieringDecision::kEarlySparkplug) {
       sfi->set_cached_tiering_decision(cached_tiering_decision);
@@ -445,8 +575,11 @@ const char* ToString(SerializedCodeSanityCheckResult result) {
 MaybeHandle<SharedFunctionInfo> CodeSerializer::Deserialize(
     Isolate* isolate, AlignedCachedData* cached_data, Handle<String> source,
     const ScriptDetails& script_details,
-    MaybeHandle<Script> maybe_cached_script) {
-  if (v8_flags.stress_background_compile) {
+    MaybeHandle<Script> maybe_cached_script, SerializeMode mode) {
+  DCHECK_IMPLIES(mode == SerializeMode::kDelta,
+                 !maybe_cached_script.is_null());
+  // The stress thread can't merge into an existing script.
+  if (v8_flags.stress_background_compile && maybe_cached_script.is_null()) {
     StressOffThreadDeserializeThread thread(isolate, cached_data);
     CHECK(thread.Start());
     thread.Join();
@@ -463,10 +596,14 @@ MaybeHandle<SharedFunctionInfo> CodeSerializer::Deserialize(
 
   SerializedCodeSanityCheckResult sanity_check_result =
       SerializedCodeSanityCheckResult::kSuccess;
+  const uint32_t expected_source_hash =
+      mode == SerializeMode::kDelta
+          ? SerializedCodeData::DeltaSourceHash(isolate, source,
+                                                script_details.origin_options)
+          : SerializedCodeData::SourceHash(source,
+                                           script_details.origin_options);
   const SerializedCodeData scd = SerializedCodeData::FromCachedData(
-      isolate, cached_data,
-      SerializedCodeData::SourceHash(source, script_details.origin_options),
-      &sanity_check_result);
+      isolate, cached_data, expected_source_hash, &sanity_check_result);
   if (sanity_check_result != SerializedCodeSanityCheckResult::kSuccess) {
     if (v8_flags.profile_deserialization) {
       PrintF("[Cached code failed check: %s]\n", ToString(sanity_check_result));
@@ -494,10 +631,22 @@ MaybeHandle<SharedFunctionInfo> CodeSerializer::Deserialize(
   // single-threaded.
   if (Handle<Script> cached_script;
       maybe_cached_script.ToHandle(&cached_script)) {
+    DirectHandle<Script> new_script(Cast<Script>(result->script()), isolate);
+    // The merge requires both scripts to have the same functions. The source
+    // hash of a full cache only covers the length, so reject a cache that
+    // doesn't line up instead of failing the merge.
+    if (new_script->infos()->length() != cached_script->infos()->length()) {
+      if (v8_flags.profile_deserialization) {
+        PrintF("[Cached code failed check: function count mismatch]\n");
+      }
+      cached_data->Reject();
+      isolate->counters()->code_cache_reject_reason()->AddSample(
+          static_cast<int>(SerializedCodeSanityCheckResult::kSourceMismatch));
+      return MaybeHandle<SharedFunctionInfo>();
+    }
     BackgroundMergeTask merge;
     merge.SetUpOnMainThread(isolate, cached_script);
     CHECK(merge.HasPendingBackgroundWork());
-    DirectHandle<Script> new_script(Cast<Script>(result->script()), isolate);
     merge.BeginMergeInBackground(isolate->AsLocalIsolate(), new_script);
     CHECK(merge.HasPendingForegroundWork());
     result = merge.CompleteMergeInForeground(isolate, new_script);
@@ -517,6 +666,23 @@ MaybeHandle<SharedFunctionInfo> CodeSerializer::Deserialize(
   return scope.CloseAndEscape(result);
 }
 
+// static
+MaybeHandle<SharedFunctionInfo> CodeSerializer::DeserializeAndMerge(
+    Isolate* isolate, AlignedCachedData* cached_data, Handle<Script> script) {
+  // Keep the fields of the existing script as they are.
+  ScriptDetails script_details(handle(script->name(), isolate),
+                               script->origin_options());
+  script_details.line_offset = script->line_offset();
+  script_details.column_offset = script->column_offset();
+  script_details.source_map_url =
+      handle(script->source_mapping_url(), isolate);
+  script_details.host_defined_options =
+      handle(script->host_defined_options(), isolate);
+  return Deserialize(isolate, cached_data,
+                     handle(Cast<String>(script->source()), isolate),
+                     script_details, script, SerializeMode::kDelta);
+}
+
 Handle<Script> CodeSerializer::OffThreadDeserializeData::GetOnlyScript(
     LocalHeap* heap) {
   std::unique_ptr<PersistentHandles> previous_persistent_handles =
@@ -767,6 +933,23 @@ uint32_t SerializedCodeData::SourceHash(DirectHandle<String> source,
   return source_length | is_module;
 }
 
+uint32_t SerializedCodeData::DeltaSourceHash(
+    Isolate* isolate, Handle<String> source,
+    ScriptOriginOptions origin_options) {
+  source = String::Flatten(isolate, source);
+  DisallowGarbageCollection no_gc;
+  String::FlatContent content = source->GetFlatContent(no_gc);
+  // Checksum the raw characters in one pass (adler32 is vectorized). A
+  // one-byte and a two-byte string with the same characters get different
+  // hashes, which only rejects the delta.
+  base::Vector<const uint8_t> bytes =
+      content.IsOneByte()
+          ? base::Vector<const uint8_t>::cast(content.ToOneByteVector())
+          : base::Vector<const uint8_t>::cast(content.ToUC16Vector());
+  return static_cast<uint32_t>(base::hash_combine(
+      SourceHash(source, origin_options), Checksum(bytes)));
+}
+
 // Return ScriptData object and relinquish ownership over it to the caller.
 AlignedCachedData* SerializedCodeData::GetScriptData() {
   DCHECK(owns_data_);
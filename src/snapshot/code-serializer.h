@@ -5,6 +5,8 @@
 #ifndef V8_SNAPSHOT_CODE_SERIALIZER_H_
 #define V8_SNAPSHOT_CODE_SERIALIZER_H_
 
+#include <unordered_map>
+
 #include "src/base/macros.h"
 #include "src/codegen/script-details.h"
 #include "src/snapshot/serializer.h"
@@ -15,6 +17,7 @@ namespace internal {
 
 class PersistentHandles;
 class BackgroundMergeTask;
+class UncompiledData;
 
 class V8_EXPORT_PRIVATE AlignedCachedData {
  public:
@@ -72,10 +75,20 @@ class CodeSerializer : public Serializer {
     SerializedCodeSanityCheckResult sanity_check_result;
   };
 
+  enum class SerializeMode {
+    // Serialize all compiled functions (modulo --code-cache-skip-old-bytecode).
+    kFull,
+    // Only serialize the bytecode of functions that were lazily compiled since
+    // the last code cache was created for the script, or since it was compiled
+    // or deserialized. Requires the script to produce compile hints.
+    kDelta,
+  };
+
   CodeSerializer(const CodeSerializer&) = delete;
   CodeSerializer& operator=(const CodeSerializer&) = delete;
   V8_EXPORT_PRIVATE static ScriptCompiler::CachedData* Serialize(
-      Isolate* isolate, Handle<SharedFunctionInfo> info);
+      Isolate* isolate, Handle<SharedFunctionInfo> info,
+      SerializeMode mode = SerializeMode::kFull);
 
   AlignedCachedData* SerializeSharedFunctionInfo(
       Handle<SharedFunctionInfo> info);
@@ -83,7 +96,15 @@ class CodeSerializer : public Serializer {
   V8_WARN_UNUSED_RESULT static MaybeHandle<SharedFunctionInfo> Deserialize(
       Isolate* isolate, AlignedCachedData* cached_data, Handle<String> source,
       const ScriptDetails& script_details,
-      MaybeHandle<Script> maybe_cached_script = {});
+      MaybeHandle<Script> maybe_cached_script = {},
+      SerializeMode mode = SerializeMode::kFull);
+
+  // Deserializes |cached_data|, a delta that must have been produced for the
+  // source of |script|, and merges the functions it contains into |script|.
+  // Rejects |cached_data| if the source or the function count don't match.
+  V8_WARN_UNUSED_RESULT static MaybeHandle<SharedFunctionInfo>
+  DeserializeAndMerge(Isolate* isolate, AlignedCachedData* cached_data,
+                      Handle<Script> script);
 
   V8_WARN_UNUSED_RESULT static OffThreadDeserializeData
   StartDeserializeOffThread(LocalIsolate* isolate,
@@ -107,8 +128,15 @@ class CodeSerializer : public Serializer {
  private:
   void SerializeObjectImpl(Handle<HeapObject> o, SlotType slot_type) override;
 
+  void AddUncompiledReplacement(DirectHandle<SharedFunctionInfo> sfi,
+                                Handle<UncompiledData> uncompiled_data);
+
   DISALLOW_GARBAGE_COLLECTION(no_gc_)
   uint32_t source_hash_;
+  // UncompiledData to serialize in place of the bytecode of functions that
+  // haven't run recently, keyed by the SharedFunctionInfo address. Addresses
+  // are stable since no GC can happen while the serializer is alive.
+  std::unordered_map<Address, Handle<UncompiledData>> uncompiled_replacements_;
 };
 
 // Wrapper around ScriptData to provide code-serializer-specific functionality.
@@ -154,6 +182,11 @@ class SerializedCodeData : public SerializedData {
 
   static uint32_t SourceHash(DirectHandle<String> source,
                              ScriptOriginOptions origin_options);
+  // Like SourceHash, but also covers the source contents. Used for deltas,
+  // whose functions must line up with those of the script they're merged
+  // into. Depends on whether the source is one-byte or two-byte.
+  static uint32_t DeltaSourceHash(Isolate* isolate, Handle<String> source,
+                                  ScriptOriginOptions origin_options);
 
  private:
   explicit SerializedCodeData(AlignedCachedData* data);
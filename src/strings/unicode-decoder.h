@@ -7,6 +7,8 @@
 
 #include "src/base/vector.h"
 #include "src/strings/unicode.h"
+#include "src/utils/memcopy.h"
+#include "src/utils/utils.h"
 
 namespace v8 {
 namespace internal {
@@ -19,7 +21,29 @@ inline int NonAsciiStart(const uint8_t* chars, int length) {
   const uint8_t* start = chars;
   const uint8_t* limit = chars + length;
 
-  if (static_cast<size_t>(length) >= kIntptrSize) {
+  DCHECK_EQ(unibrow::Utf8::kMaxOneByteChar, 0x7F);
+#if defined(__SSE3__)
+  // Check 16 bytes at a time. The sign bits of the bytes are exactly the
+  // non-ASCII markers, so the movemask gives the precise position.
+  while (limit - chars >= static_cast<ptrdiff_t>(sizeof(__m128i))) {
+    uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars))));
+    if (mask != 0) {
+      return static_cast<int>(chars - start) +
+             base::bits::CountTrailingZeros(mask);
+    }
+    chars += sizeof(__m128i);
+  }
+#elif defined(V8_OPTIMIZE_WITH_NEON)
+  // Check 16 bytes at a time, leaving the exact position of a non-ASCII byte
+  // to the loops below.
+  while (limit - chars >= static_cast<ptrdiff_t>(sizeof(uint8x16_t))) {
+    if (vmaxvq_u8(vld1q_u8(chars)) > unibrow::Utf8::kMaxOneByteChar) break;
+    chars += sizeof(uint8x16_t);
+  }
+#endif
+
+  if (static_cast<size_t>(limit - chars) >= kIntptrSize) {
     // Check unaligned bytes.
     while (!IsAligned(reinterpret_cast<intptr_t>(chars), kIntptrSize)) {
       if (*chars > unibrow::Utf8::kMaxOneByteChar) {
@@ -28,7 +52,6 @@ inline int NonAsciiStart(const uint8_t* chars, int length) {
       ++chars;
     }
     // Check aligned words.
-    DCHECK_EQ(unibrow::Utf8::kMaxOneByteChar, 0x7F);
     const uintptr_t non_one_byte_mask = kUintptrAllBitsSet / 0xFF * 0x80;
     while (chars + sizeof(uintptr_t) <= limit) {
       if (*reinterpret_cast<const uintptr_t*>(chars) & non_one_byte_mask) {
@@ -48,6 +71,39 @@ inline int NonAsciiStart(const uint8_t* chars, int length) {
   return static_cast<int>(chars - start);
 }
 
+// Copies the ASCII prefix of `src` to `dst`, widening each byte to a UTF-16
+// code unit, and returns the number of chars copied. Like NonAsciiStart, this
+// may stop a few chars before the first non-ASCII byte. With SIMD, each block
+// of 16 bytes is checked and widened in the same pass, instead of scanning
+// the input once for its ASCII prefix and once more to copy it.
+inline int CopyAsciiChars(uint16_t* dst, const uint8_t* src, int length) {
+  int copied = 0;
+#if defined(__SSE3__)
+  const __m128i zero = _mm_setzero_si128();
+  for (; length - copied >= static_cast<int>(sizeof(__m128i));
+       copied += sizeof(__m128i)) {
+    __m128i bytes =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + copied));
+    if (_mm_movemask_epi8(bytes) != 0) break;
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + copied),
+                     _mm_unpacklo_epi8(bytes, zero));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + copied + 8),
+                     _mm_unpackhi_epi8(bytes, zero));
+  }
+#elif defined(V8_OPTIMIZE_WITH_NEON)
+  for (; length - copied >= static_cast<int>(sizeof(uint8x16_t));
+       copied += sizeof(uint8x16_t)) {
+    uint8x16_t bytes = vld1q_u8(src + copied);
+    if (vmaxvq_u8(bytes) > unibrow::Utf8::kMaxOneByteChar) break;
+    vst1q_u16(dst + copied, vmovl_u8(vget_low_u8(bytes)));
+    vst1q_u16(dst + copied + 8, vmovl_high_u8(bytes));
+  }
+#endif
+  int ascii_length = copied + NonAsciiStart(src + copied, length - copied);
+  CopyChars(dst + copied, src + copied, ascii_length - copied);
+  return ascii_length;
+}
+
 template <class Decoder>
 class Utf8DecoderBase {
  public:
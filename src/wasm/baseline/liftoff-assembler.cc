@@ -651,6 +651,30 @@ void LiftoffAssembler::SpillLocals() {
   }
 }
 
+void LiftoffAssembler::SpillLocalsForLoop() {
+  // Keep locals in registers if the register is not shared with any other
+  // stack slot, and as long as at least half of the cache registers of each
+  // register class stay available for the loop body. The back-edges will move
+  // the local values back into those registers.
+  constexpr int kMaxGpLocals = kGpCacheRegList.GetNumRegsSet() / 2;
+  constexpr int kMaxFpLocals = kFpCacheRegList.GetNumRegsSet() / 2;
+  int num_gp_locals = 0;
+  int num_fp_locals = 0;
+  for (VarState& local_slot :
+       base::VectorOf(cache_state_.stack_state.data(), num_locals_)) {
+    if (local_slot.is_reg() && !local_slot.reg().is_pair() &&
+        cache_state_.get_use_count(local_slot.reg()) == 1) {
+      bool is_gp = local_slot.reg().is_gp();
+      int& num_kept = is_gp ? num_gp_locals : num_fp_locals;
+      if (num_kept < (is_gp ? kMaxGpLocals : kMaxFpLocals)) {
+        ++num_kept;
+        continue;
+      }
+    }
+    Spill(&local_slot);
+  }
+}
+
 void LiftoffAssembler::SpillAllRegisters() {
   for (VarState& slot : cache_state_.stack_state) {
     if (!slot.is_reg()) continue;
@@ -564,6 +564,9 @@ class LiftoffAssembler : public MacroAssembler {
 
   void Spill(VarState* slot);
   void SpillLocals();
+  // Spill locals before entering a loop, but keep some of them in registers
+  // which are not used otherwise.
+  void SpillLocalsForLoop();
   void SpillAllRegisters();
   inline void LoadSpillAddress(Register dst, int offset, ValueKind kind);
 
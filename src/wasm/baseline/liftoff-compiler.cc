@@ -33,6 +33,7 @@
 #include "src/wasm/object-access.h"
 #include "src/wasm/signature-hashing.h"
 #include "src/wasm/simd-shuffle.h"
+#include "src/wasm/wasm-code-manager.h"
 #include "src/wasm/wasm-debug.h"
 #include "src/wasm/wasm-engine.h"
 #include "src/wasm/wasm-linkage.h"
@@ -651,8 +652,8 @@ class LiftoffCompiler {
   }
 
   base::OwnedVector<uint8_t> GetProtectedInstructionsData() const {
-    return base::OwnedVector<uint8_t>::Of(base::Vector<const uint8_t>::cast(
-        base::VectorOf(protected_instructions_)));
+    return WasmCode::EncodeProtectedInstructions(
+        base::VectorOf(protected_instructions_));
   }
 
   uint32_t GetTotalFrameSlotCountForGC() const {
@@ -951,8 +952,11 @@ class LiftoffCompiler {
     DefineSafepoint();
   }
 
+  // Whether to emit tiering budget checks. With --wasm-sampling-tier-up, hot
+  // functions are detected by sampling instead.
   bool dynamic_tiering() {
     return env_->dynamic_tiering && for_debugging_ == kNotForDebugging &&
+           !v8_flags.wasm_sampling_tier_up &&
            (v8_flags.wasm_tier_up_filter == -1 ||
             v8_flags.wasm_tier_up_filter == func_index_);
   }
@@ -1391,9 +1395,18 @@ class LiftoffCompiler {
     // Before entering a loop, spill all locals to the stack, in order to free
     // the cache registers, and to avoid unnecessarily reloading stack values
     // into registers at branches.
+    // With --liftoff-loop-locals-in-registers, locals which occupy a register
+    // on their own stay in that register (up to half of the cache registers),
+    // so that loops don't load and store them on every iteration. This is not
+    // done for debugging code, which expects locals to be on the stack.
     // TODO(clemensb): Come up with a better strategy here, involving
     // pre-analysis of the function.
-    __ SpillLocals();
+    if (v8_flags.liftoff_loop_locals_in_registers &&
+        for_debugging_ == kNotForDebugging) {
+      __ SpillLocalsForLoop();
+    } else {
+      __ SpillLocals();
+    }
 
     __ SpillLoopArgs(loop->start_merge.arity);
 
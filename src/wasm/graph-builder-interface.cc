@@ -957,6 +957,23 @@ class WasmGraphBuildingInterface {
       case WKI::kDataViewSetUint32:
       case WKI::kDataViewByteLength:
       case WKI::kFastAPICall:
+      case WKI::kMathAbs:
+      case WKI::kMathAcos:
+      case WKI::kMathAsin:
+      case WKI::kMathAtan:
+      case WKI::kMathAtan2:
+      case WKI::kMathCeil:
+      case WKI::kMathCos:
+      case WKI::kMathExp:
+      case WKI::kMathFloor:
+      case WKI::kMathFround:
+      case WKI::kMathLog:
+      case WKI::kMathMax:
+      case WKI::kMathMin:
+      case WKI::kMathPow:
+      case WKI::kMathSin:
+      case WKI::kMathSqrt:
+      case WKI::kMathTan:
         return false;
     }
     if (v8_flags.trace_wasm_inlining) {
@@ -1040,6 +1040,8 @@
   V(s2s_SimdI8x16ReplaceLane)                   \
   V(s2s_SimdS128LoadMem)                        \
   V(s2s_SimdS128StoreMem)                       \
+  V(s2s_SimdS128LoadStoreMem)                   \
+  V(s2s_SimdS128LoadMem_LocalSet)               \
   V(s2s_SimdI64x2Shl)                           \
   V(s2s_SimdI64x2ShrS)                          \
   V(s2s_SimdI64x2ShrU)                          \
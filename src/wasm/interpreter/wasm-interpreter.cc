@@ -4141,6 +4141,69 @@ INSTRUCTION_HANDLER_FUNC s2s_SimdS128StoreMem(
   NextOp();
 }
 
+// Super-instruction for v128.load followed by v128.store, as in vectorized
+// memcpy loops.
+INSTRUCTION_HANDLER_FUNC s2s_SimdS128LoadStoreMem(
+    const uint8_t* code, uint32_t* sp, WasmInterpreterRuntime* wasm_runtime,
+    int64_t r0, double fp0) {
+  uint8_t* memory_start = wasm_runtime->GetMemoryStart();
+
+  uint64_t load_offset = Read<uint64_t>(code);
+  uint64_t load_index = pop<uint32_t>(sp, code, wasm_runtime);
+  uint64_t effective_load_index = load_offset + load_index;
+
+  uint64_t store_offset = Read<uint64_t>(code);
+  uint64_t store_index = pop<uint32_t>(sp, code, wasm_runtime);
+  uint64_t effective_store_index = store_offset + store_index;
+
+  if (V8_UNLIKELY(
+          effective_load_index < load_index ||
+          !base::IsInBounds<uint64_t>(effective_load_index, sizeof(Simd128),
+                                      wasm_runtime->GetMemorySize()) ||
+          effective_store_index < store_index ||
+          !base::IsInBounds<uint64_t>(effective_store_index, sizeof(Simd128),
+                                      wasm_runtime->GetMemorySize()))) {
+    TRAP(TrapReason::kTrapMemOutOfBounds)
+  }
+
+  uint8_t* load_address = memory_start + effective_load_index;
+  uint8_t* store_address = memory_start + effective_store_index;
+
+  base::WriteUnalignedValue<Simd128>(
+      reinterpret_cast<Address>(store_address),
+      base::ReadUnalignedValue<Simd128>(
+          reinterpret_cast<Address>(load_address)));
+
+  NextOp();
+}
+
+// Super-instruction for v128.load followed by local.set.
+INSTRUCTION_HANDLER_FUNC s2s_SimdS128LoadMem_LocalSet(
+    const uint8_t* code, uint32_t* sp, WasmInterpreterRuntime* wasm_runtime,
+    int64_t r0, double fp0) {
+  uint8_t* memory_start = wasm_runtime->GetMemoryStart();
+  uint64_t offset = Read<uint64_t>(code);
+
+  uint64_t index = pop<uint32_t>(sp, code, wasm_runtime);
+  uint64_t effective_index = offset + index;
+
+  if (V8_UNLIKELY(effective_index < index ||
+                  !base::IsInBounds<uint64_t>(effective_index, sizeof(Simd128),
+                                              wasm_runtime->GetMemorySize()))) {
+    TRAP(TrapReason::kTrapMemOutOfBounds)
+  }
+
+  uint8_t* address = memory_start + effective_index;
+  Simd128 value =
+      base::ReadUnalignedValue<Simd128>(reinterpret_cast<Address>(address));
+
+  uint32_t to = ReadI32(code);
+  base::WriteUnalignedValue<Simd128>(reinterpret_cast<Address>(sp + to),
+                                     value);
+
+  NextOp();
+}
+
 #define SHIFT_CASE(op, name, stype, count, expr)                              \
   INSTRUCTION_HANDLER_FUNC s2s_Simd##op(const uint8_t* code, uint32_t* sp,    \
                                         WasmInterpreterRuntime* wasm_runtime, \
@@ -11107,6 +11170,29 @@ bool WasmBytecodeGenerator::EncodeSuperInstruction(
     I32Pop();
     reg_mode = RegMode::kNoReg;
     return true;
+  } else if (reg_mode == RegMode::kNoReg &&
+             curr_instr.opcode == kExprS128LoadMem &&
+             next_instr.opcode == kExprS128StoreMem) {
+    EMIT_INSTR_HANDLER_WITH_PC(s2s_SimdS128LoadStoreMem, curr_instr.pc);
+    EmitI64Const(
+        static_cast<uint64_t>(curr_instr.optional.offset));  // load_offset
+    I32Pop();                                                // load_index
+    EmitI64Const(
+        static_cast<uint64_t>(next_instr.optional.offset));  // store_offset
+    I32Pop();                                                // store_index
+    return true;
+  } else if (reg_mode == RegMode::kNoReg &&
+             curr_instr.opcode == kExprS128LoadMem &&
+             next_instr.orig == kExprLocalSet) {
+    // Do not optimize if we are updating a shared slot.
+    uint32_t to_stack_index = next_instr.optional.index;
+    if (HasSharedSlot(to_stack_index)) return false;
+
+    EMIT_INSTR_HANDLER_WITH_PC(s2s_SimdS128LoadMem_LocalSet, curr_instr.pc);
+    EmitI64Const(static_cast<uint64_t>(curr_instr.optional.offset));
+    I32Pop();
+    EmitI32Const(slots_[stack_[to_stack_index]].slot_offset);
+    return true;
   } else if (curr_instr.orig >= kExprI32Const &&
              curr_instr.orig <= kExprF32Const &&
              next_instr.orig == kExprLocalSet) {
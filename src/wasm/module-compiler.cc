@@ -643,6 +643,9 @@ class CompilationStateImpl {
 
   void OnFinishedUnits(base::Vector<WasmCode*>);
   void OnFinishedJSToWasmWrapperUnits();
+  // Records the tier of code that was deserialized on the first call of a
+  // function, see --wasm-lazy-deserialization.
+  void OnLazilyDeserializedCode(WasmCode*);
 
   void OnCompilationStopped(WasmDetectedFeatures detected);
   void PublishDetectedFeaturesAfterCompilation(Isolate*);
@@ -1201,6 +1204,29 @@ bool CompileLazy(Isolate* isolate,
   CompilationStateImpl* compilation_state =
       Impl(native_module->compilation_state());
   DebugState is_in_debug_state = native_module->IsInDebugState();
+
+  // Functions of deserialized modules might still have their TurboFan code in
+  // the serialized data, see --wasm-lazy-deserialization.
+  LazilyDeserializedCode* lazy_code = native_module->lazily_deserialized_code();
+  if (lazy_code != nullptr && is_in_debug_state == kNotDebugging) {
+    WasmCodeRefScope code_ref_scope;
+    bool deserialized;
+    if (WasmCode* code = lazy_code->DeserializeFunction(
+            native_module, func_index, &deserialized)) {
+      // If another thread deserialized the function first, its code is
+      // already published and logged.
+      if (!deserialized) return true;
+      TRACE_LAZY("Deserialized wasm-function#%d.\n", func_index);
+      compilation_state->OnLazilyDeserializedCode(code);
+      if (V8_UNLIKELY(native_module->log_code())) {
+        GetWasmEngine()->LogCode(base::VectorOf(&code, 1));
+        GetWasmEngine()->LogOutstandingCodesForIsolate(isolate);
+      }
+      counters->wasm_lazily_deserialized_functions()->Increment();
+      return true;
+    }
+  }
+
   ExecutionTierPair tiers =
       GetLazyCompilationTiers(native_module, func_index, is_in_debug_state);
 
@@ -2583,15 +2609,23 @@ struct ValidateFunctionsStreamingJobData {
     // delays is the right thing to do to avoid too many small validation tasks.
     // We notify on each power of two after 16 units, and every 16k units (just
     // to have *some* upper limit and avoiding to pile up too many units).
+    // As function sizes vary a lot, also notify after every
+    // {kNotifyAfterCodeSize} bytes of function bodies, such that validation
+    // keeps up with the download of modules with big functions.
     // Additionally, notify after receiving the last unit of the module.
+    code_size_since_notify += code.size();
     if ((total_units_added >= 16 &&
          base::bits::IsPowerOfTwo(total_units_added)) ||
-        (total_units_added % (16 * 1024)) == 0 || ptr == units.end()) {
+        (total_units_added % (16 * 1024)) == 0 ||
+        code_size_since_notify >= kNotifyAfterCodeSize || ptr == units.end()) {
+      code_size_since_notify = 0;
       job_handle->NotifyConcurrencyIncrease();
     }
   }
 
   size_t NumOutstandingUnits() const {
+    // After finding an error, the remaining units do not need validation.
+    if (found_error.load(std::memory_order_relaxed)) return 0;
     Unit* next = next_available_unit.load(std::memory_order_relaxed);
     Unit* end = end_of_available_units.load(std::memory_order_relaxed);
     DCHECK_LE(next, end);
@@ -2615,7 +2649,11 @@ struct ValidateFunctionsStreamingJobData {
     return {};
   }
 
+  static constexpr size_t kNotifyAfterCodeSize = 1 * MB;
+
   base::OwnedVector<Unit> units;
+  // Only accessed by the thread adding units.
+  size_t code_size_since_notify = 0;
   std::atomic<Unit*> next_available_unit;
   std::atomic<Unit*> end_of_available_units;
   std::atomic<bool> found_error{false};
@@ -2632,7 +2670,9 @@ class ValidateFunctionsStreamingJob final : public JobTask {
     TRACE_EVENT0("v8.wasm", "wasm.ValidateFunctionsStreaming");
     using Unit = ValidateFunctionsStreamingJobData::Unit;
     Zone validation_zone{GetWasmEngine()->allocator(), ZONE_NAME};
-    while (Unit unit = data_->GetUnit()) {
+    while (!data_->found_error.load(std::memory_order_relaxed)) {
+      Unit unit = data_->GetUnit();
+      if (!unit) break;
       validation_zone.Reset();
       DecodeResult result =
           ValidateSingleFunction(&validation_zone, module_, unit.func_index,
@@ -3378,6 +3418,14 @@ bool AsyncStreamingProcessor::ProcessCodeSectionHeader(
 bool AsyncStreamingProcessor::ProcessFunctionBody(
     base::Vector<const uint8_t> bytes, uint32_t offset) {
   TRACE_STREAMING("Process function body %d ...\n", num_functions_);
+  // If background validation already found an invalid function, fail the
+  // stream right away. This skips decoding and compiling the remaining
+  // functions; the error is reported when the stream finishes, after
+  // revalidating the full module for a deterministic error message.
+  if (validate_functions_job_data_.found_error.load(
+          std::memory_order_relaxed)) {
+    return false;
+  }
   uint32_t func_index =
       decoder_.module()->num_imported_functions + num_functions_;
   ++num_functions_;
@@ -4088,6 +4136,15 @@ std::optional<WasmCompilationUnit> CompilationStateImpl::GetNextCompilationUnit(
   return compilation_unit_queues_.GetNextUnit(queue, tier);
 }
 
+void CompilationStateImpl::OnLazilyDeserializedCode(WasmCode* code) {
+  base::MutexGuard guard(&callbacks_mutex_);
+  uint8_t& progress = compilation_progress_[declared_function_index(
+      native_module_->module(), code->index())];
+  if (code->tier() > ReachedTierField::decode(progress)) {
+    progress = ReachedTierField::update(progress, code->tier());
+  }
+}
+
 void CompilationStateImpl::OnFinishedUnits(
     base::Vector<WasmCode*> code_vector) {
   TRACE_EVENT1(TRACE_DISABLED_BY_DEFAULT("v8.wasm.detailed"),
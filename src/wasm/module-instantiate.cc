@@ -372,6 +372,15 @@ bool IsDataViewSetterSig(const wasm::FunctionSig* sig,
          sig->GetParam(3) == wasm::kWasmI32;
 }
 
+// Checks whether {sig} is the signature of the (possibly asm.js-only) Wasm
+// instruction {opcode}.
+bool HasSignatureOf(const wasm::FunctionSig* sig, wasm::WasmOpcode opcode) {
+  const wasm::FunctionSig* opcode_sig = wasm::WasmOpcodes::Signature(opcode);
+  if (!opcode_sig) opcode_sig = wasm::WasmOpcodes::AsmjsSignature(opcode);
+  DCHECK_NOT_NULL(opcode_sig);
+  return *sig == *opcode_sig;
+}
+
 const MachineSignature* GetFunctionSigForFastApiImport(
     Zone* zone, const CFunctionInfo* info) {
   uint32_t arg_count = info->ArgumentCount();
@@ -419,6 +428,49 @@ WellKnownImport CheckForWellKnownImport(
           return WellKnownImport::kParseFloat;
         }
         break;
+
+        // =================================================================
+        // Math functions. Their Wasm instructions compute the same results,
+        // so Turbofan can replace the call by the instruction.
+#define MATH_F64(name)                               \
+  case Builtin::kMath##name:                         \
+    if (v8_flags.wasm_math_intrinsics &&             \
+        HasSignatureOf(sig, wasm::kExprF64##name)) { \
+      return WellKnownImport::kMath##name;           \
+    }                                                \
+    break;
+#define MATH_F32_F64(name)                             \
+  case Builtin::kMath##name:                           \
+    if (v8_flags.wasm_math_intrinsics &&               \
+        (HasSignatureOf(sig, wasm::kExprF64##name) ||  \
+         HasSignatureOf(sig, wasm::kExprF32##name))) { \
+      return WellKnownImport::kMath##name;             \
+    }                                                  \
+    break;
+        MATH_F64(Acos)
+        MATH_F64(Asin)
+        MATH_F64(Atan)
+        MATH_F64(Atan2)
+        MATH_F64(Cos)
+        MATH_F64(Exp)
+        MATH_F64(Log)
+        MATH_F64(Pow)
+        MATH_F64(Sin)
+        MATH_F64(Tan)
+        MATH_F32_F64(Abs)
+        MATH_F32_F64(Ceil)
+        MATH_F32_F64(Floor)
+        MATH_F32_F64(Max)
+        MATH_F32_F64(Min)
+        MATH_F32_F64(Sqrt)
+#undef MATH_F64
+#undef MATH_F32_F64
+      case Builtin::kMathFround:
+        if (v8_flags.wasm_math_intrinsics &&
+            HasSignatureOf(sig, wasm::kExprF32ConvertF64)) {
+          return WellKnownImport::kMathFround;
+        }
+        break;
       default:
         break;
     }
@@ -766,15 +818,11 @@ ImportCallKind ResolvedWasmImport::ComputeKind(
     DirectHandle<SharedFunctionInfo> shared(function->shared(), isolate);
 
 // Check for math intrinsics.
-#define COMPARE_SIG_FOR_BUILTIN(name)                                     \
-  {                                                                       \
-    const wasm::FunctionSig* sig =                                        \
-        wasm::WasmOpcodes::Signature(wasm::kExpr##name);                  \
-    if (!sig) sig = wasm::WasmOpcodes::AsmjsSignature(wasm::kExpr##name); \
-    DCHECK_NOT_NULL(sig);                                                 \
-    if (*expected_sig == *sig) {                                          \
-      return ImportCallKind::k##name;                                     \
-    }                                                                     \
+#define COMPARE_SIG_FOR_BUILTIN(name)                      \
+  {                                                        \
+    if (HasSignatureOf(expected_sig, wasm::kExpr##name)) { \
+      return ImportCallKind::k##name;                      \
+    }                                                      \
   }
 #define COMPARE_SIG_FOR_BUILTIN_F64(name) \
   case Builtin::kMath##name:              \
@@ -2622,6 +2670,12 @@ void InstanceBuilder::ProcessExports(
   const PropertyDetails details{PropertyKind::kData, desc.ToAttributes(),
                                 PropertyConstness::kMutable};
 
+  // A module imported from another isolate comes without the JS-to-Wasm
+  // wrappers of this isolate. Compile the missing ones that cannot use the
+  // generic wrapper in parallel, instead of one by one below. Usually they
+  // already exist and nothing gets compiled.
+  CompileJsToWasmWrappers(isolate_, module_);
+
   // Process each export in the export table.
   for (const WasmExport& exp : module_->export_table) {
     Handle<String> name = WasmModuleObject::ExtractUtf8StringFromModuleBytes(
@@ -2209,6 +2209,52 @@ class TurboshaftGraphBuildingInterface : public WasmGraphBuilderBase {
     }
   }
 
+  // Returns the Wasm instruction that computes the same function as the
+  // well-known Math import {wki} for the import's signature {sig}.
+  static WasmOpcode MathImportOpcode(WellKnownImport wki,
+                                     const FunctionSig* sig) {
+    using WKI = WellKnownImport;
+    bool is_f32 = sig->GetReturn(0) == kWasmF32;
+    switch (wki) {
+      case WKI::kMathAbs:
+        return is_f32 ? kExprF32Abs : kExprF64Abs;
+      case WKI::kMathAcos:
+        return kExprF64Acos;
+      case WKI::kMathAsin:
+        return kExprF64Asin;
+      case WKI::kMathAtan:
+        return kExprF64Atan;
+      case WKI::kMathAtan2:
+        return kExprF64Atan2;
+      case WKI::kMathCeil:
+        return is_f32 ? kExprF32Ceil : kExprF64Ceil;
+      case WKI::kMathCos:
+        return kExprF64Cos;
+      case WKI::kMathExp:
+        return kExprF64Exp;
+      case WKI::kMathFloor:
+        return is_f32 ? kExprF32Floor : kExprF64Floor;
+      case WKI::kMathFround:
+        return kExprF32ConvertF64;
+      case WKI::kMathLog:
+        return kExprF64Log;
+      case WKI::kMathMax:
+        return is_f32 ? kExprF32Max : kExprF64Max;
+      case WKI::kMathMin:
+        return is_f32 ? kExprF32Min : kExprF64Min;
+      case WKI::kMathPow:
+        return kExprF64Pow;
+      case WKI::kMathSin:
+        return kExprF64Sin;
+      case WKI::kMathSqrt:
+        return is_f32 ? kExprF32Sqrt : kExprF64Sqrt;
+      case WKI::kMathTan:
+        return kExprF64Tan;
+      default:
+        UNREACHABLE();
+    }
+  }
+
   bool HandleWellKnownImport(FullDecoder* decoder,
                              const CallFunctionImmediate& imm,
                              const Value args[], Value returns[]) {
@@ -2581,6 +2627,31 @@ class TurboshaftGraphBuildingInterface : public WasmGraphBuilderBase {
         result = returns[0].op;
         break;
       }
+
+      // Math functions.
+      case WKI::kMathAbs:
+      case WKI::kMathAcos:
+      case WKI::kMathAsin:
+      case WKI::kMathAtan:
+      case WKI::kMathCeil:
+      case WKI::kMathCos:
+      case WKI::kMathExp:
+      case WKI::kMathFloor:
+      case WKI::kMathFround:
+      case WKI::kMathLog:
+      case WKI::kMathSin:
+      case WKI::kMathSqrt:
+      case WKI::kMathTan:
+        result = UnOpImpl(MathImportOpcode(imported_op, imm.sig), args[0].op,
+                          args[0].type);
+        break;
+      case WKI::kMathAtan2:
+      case WKI::kMathMax:
+      case WKI::kMathMin:
+      case WKI::kMathPow:
+        result = BinOpImpl(MathImportOpcode(imported_op, imm.sig), args[0].op,
+                           args[1].op);
+        break;
     }
     if (v8_flags.trace_wasm_inlining) {
       PrintF("[function %d: call to %d is well-known %s]\n", func_index_, index,
@@ -2613,8 +2684,7 @@ class TurboshaftGraphBuildingInterface : public WasmGraphBuilderBase {
         }
         InlineWasmCall(decoder, imm.index, imm.sig, 0, false, args, returns);
       } else {
-        V<WordPtr> callee =
-            __ RelocatableConstant(imm.index, RelocInfo::WASM_CALL);
+        V<WordPtr> callee = DirectCallTarget(decoder, imm.index);
         BuildWasmCall(decoder, imm.sig, callee,
                       trusted_instance_data(
                           decoder->module_->function_is_shared(imm.index)),
@@ -2644,8 +2714,7 @@ class TurboshaftGraphBuildingInterface : public WasmGraphBuilderBase {
         InlineWasmCall(decoder, imm.index, imm.sig, 0, true, args, nullptr);
       } else {
         BuildWasmMaybeReturnCall(
-            decoder, imm.sig,
-            __ RelocatableConstant(imm.index, RelocInfo::WASM_CALL),
+            decoder, imm.sig, DirectCallTarget(decoder, imm.index),
             trusted_instance_data(
                 decoder->module_->function_is_shared(imm.index)),
             args);
@@ -7284,6 +7353,23 @@ class TurboshaftGraphBuildingInterface : public WasmGraphBuilderBase {
                                              expected_sig_hash);
   }
 
+  // The call target of the locally defined function {func_index}. By default
+  // this is a near call into the jump table, which is patched whenever the
+  // code is copied, e.g. when deserializing it. With
+  // --wasm-position-independent-calls, the jump table slot is computed from the
+  // instance instead, so the instructions don't depend on where they live.
+  V<WordPtr> DirectCallTarget(FullDecoder* decoder, uint32_t func_index) {
+    if (!v8_flags.wasm_position_independent_calls) {
+      return __ RelocatableConstant(func_index, RelocInfo::WASM_CALL);
+    }
+    bool shared_func = decoder->module_->function_is_shared(func_index);
+    V<WordPtr> jump_table_start =
+        LOAD_INSTANCE_FIELD(trusted_instance_data(shared_func), JumpTableStart,
+                            MemoryRepresentation::UintPtr());
+    return __ WordPtrAdd(jump_table_start,
+                         JumpTableOffset(decoder->module_, func_index));
+  }
+
   OpIndex AnnotateResultIfReference(OpIndex result, wasm::ValueType type) {
     return type.is_object_reference()
                ? __ AnnotateWasmType(V<Object>::Cast(result), type)
@@ -8025,8 +8111,7 @@ class TurboshaftGraphBuildingInterface : public WasmGraphBuilderBase {
         // Since this situation is highly unlikely though, we just ignore this
         // inlinee, emit a regular call, and move on. The same validation error
         // will be triggered again when actually compiling the invalid function.
-        V<WordPtr> callee =
-            __ RelocatableConstant(func_index, RelocInfo::WASM_CALL);
+        V<WordPtr> callee = DirectCallTarget(decoder, func_index);
         if (is_tail_call) {
           BuildWasmMaybeReturnCall(
               decoder, sig, callee,
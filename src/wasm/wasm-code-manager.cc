@@ -18,6 +18,7 @@
 #include "src/base/small-vector.h"
 #include "src/base/string-format.h"
 #include "src/base/vector.h"
+#include "src/base/vlq.h"
 #include "src/codegen/assembler-inl.h"
 #include "src/codegen/macro-assembler-inl.h"
 #include "src/codegen/macro-assembler.h"
@@ -47,6 +48,7 @@
 #include "src/wasm/wasm-module.h"
 #include "src/wasm/wasm-objects-inl.h"
 #include "src/wasm/wasm-objects.h"
+#include "src/wasm/wasm-serialization.h"
 #include "src/wasm/well-known-imports.h"
 
 #if V8_ENABLE_DRUMBRAKE
@@ -211,6 +213,34 @@ std::unique_ptr<const uint8_t[]> WasmCode::ConcatenateBytes(
   return result;
 }
 
+// static
+base::OwnedVector<uint8_t> WasmCode::EncodeProtectedInstructions(
+    base::Vector<const ProtectedInstructionData> instructions) {
+  std::vector<uint8_t> data;
+  data.reserve(instructions.size());
+  uint32_t last_offset = 0;
+  for (const ProtectedInstructionData& instruction : instructions) {
+    // Instructions are recorded in code order, which
+    // {IsProtectedInstruction} relies on.
+    DCHECK_LE(last_offset, instruction.instr_offset);
+    base::VLQEncodeUnsigned(&data, instruction.instr_offset - last_offset);
+    last_offset = instruction.instr_offset;
+  }
+  return base::OwnedVector<uint8_t>::Of(data);
+}
+
+// static
+std::vector<ProtectedInstructionData> WasmCode::DecodeProtectedInstructions(
+    base::Vector<const uint8_t> data) {
+  std::vector<ProtectedInstructionData> instructions;
+  uint32_t offset = 0;
+  for (int index = 0; index < data.length();) {
+    offset += base::VLQDecodeUnsigned(data.begin(), &index);
+    instructions.push_back({offset});
+  }
+  return instructions;
+}
+
 void WasmCode::RegisterTrapHandlerData() {
   DCHECK(!has_trap_handler_index());
   if (kind() != WasmCode::kWasmFunction) return;
@@ -219,10 +249,13 @@ void WasmCode::RegisterTrapHandlerData() {
   Address base = instruction_start();
 
   size_t size = instructions().size();
-  auto protected_instruction_data = this->protected_instructions();
+  // The trap handler copies the decoded data, so the temporary vector can be
+  // freed afterwards.
+  std::vector<ProtectedInstructionData> protected_instruction_data =
+      protected_instructions();
   const int index =
       RegisterHandlerData(base, size, protected_instruction_data.size(),
-                          protected_instruction_data.begin());
+                          protected_instruction_data.data());
 
   // TODO(eholk): if index is negative, fail.
   CHECK_LE(0, index);
@@ -312,20 +345,65 @@ void WasmCode::LogCode(Isolate* isolate, const char* source_url,
                                    name, source_url, code_offset, script_id));
 }
 
-namespace {
-bool ProtectedInstructionDataCompare(const ProtectedInstructionData& left,
-                                     const ProtectedInstructionData& right) {
-  return left.instr_offset < right.instr_offset;
+struct WasmCode::ProtectedInstructionsIndex {
+  struct Entry {
+    uint32_t offset;
+    // Position of the next entry in the encoded data.
+    int next_index;
+  };
+  std::vector<Entry> entries;
+};
+
+const WasmCode::ProtectedInstructionsIndex*
+WasmCode::GetOrBuildProtectedInstructionsIndex() {
+  const ProtectedInstructionsIndex* index =
+      protected_instructions_index_.load(std::memory_order_acquire);
+  if (index) return index;
+
+  auto new_index = std::make_unique<ProtectedInstructionsIndex>();
+  base::Vector<const uint8_t> data = protected_instructions_data();
+  uint32_t offset = 0;
+  int count = 0;
+  for (int i = 0; i < data.length();) {
+    offset += base::VLQDecodeUnsigned(data.begin(), &i);
+    if (++count % kProtectedInstructionsIndexStride == 0) {
+      new_index->entries.push_back({offset, i});
+    }
+  }
+  // Another thread might have built the index in the meantime; keep theirs.
+  if (protected_instructions_index_.compare_exchange_strong(
+          index, new_index.get(), std::memory_order_acq_rel)) {
+    return new_index.release();
+  }
+  return index;
 }
-}  // namespace
 
 bool WasmCode::IsProtectedInstruction(Address pc) {
-  base::Vector<const trap_handler::ProtectedInstructionData> instructions =
-      protected_instructions();
-  ProtectedInstructionData offset{
-      static_cast<uint32_t>(pc - instruction_start())};
-  return std::binary_search(instructions.begin(), instructions.end(), offset,
-                            ProtectedInstructionDataCompare);
+  uint32_t pc_offset = static_cast<uint32_t>(pc - instruction_start());
+  base::Vector<const uint8_t> data = protected_instructions_data();
+  uint32_t offset = 0;
+  int index = 0;
+  if (data.length() >= kMinProtectedInstructionsSizeForIndex) {
+    const std::vector<ProtectedInstructionsIndex::Entry>& entries =
+        GetOrBuildProtectedInstructionsIndex()->entries;
+    auto next = std::upper_bound(
+        entries.begin(), entries.end(), pc_offset,
+        [](uint32_t value, const ProtectedInstructionsIndex::Entry& entry) {
+          return value < entry.offset;
+        });
+    if (next != entries.begin()) {
+      --next;
+      if (next->offset == pc_offset) return true;
+      offset = next->offset;
+      index = next->next_index;
+    }
+  }
+  // The offsets are sorted, so stop at the first one past {pc_offset}.
+  while (index < data.length()) {
+    offset += base::VLQDecodeUnsigned(data.begin(), &index);
+    if (offset >= pc_offset) return offset == pc_offset;
+  }
+  return false;
 }
 
 void WasmCode::Validate() const {
@@ -535,6 +613,7 @@ WasmCode::~WasmCode() {
   if (has_trap_handler_index()) {
     trap_handler::ReleaseHandlerData(trap_handler_index());
   }
+  delete protected_instructions_index_.load(std::memory_order_relaxed);
 }
 
 V8_WARN_UNUSED_RESULT bool WasmCode::DecRefOnPotentiallyDeadCode() {
@@ -594,12 +673,16 @@ std::tuple<int, bool, SourcePosition> WasmCode::GetInliningPosition(
 }
 
 size_t WasmCode::EstimateCurrentMemoryConsumption() const {
-  UPDATE_WHEN_CLASS_CHANGES(WasmCode, 96);
+  UPDATE_WHEN_CLASS_CHANGES(WasmCode, 104);
   size_t result = sizeof(WasmCode);
   // For meta_data_.
   result += protected_instructions_size_ + reloc_info_size_ +
             source_positions_size_ + inlining_positions_size_ +
             deopt_data_size_;
+  if (const ProtectedInstructionsIndex* index =
+          protected_instructions_index_.load(std::memory_order_acquire)) {
+    result += sizeof(ProtectedInstructionsIndex) + ContentSize(index->entries);
+  }
   return result;
 }
 
@@ -1303,6 +1386,8 @@ WasmCode* NativeModule::PublishCodeLocked(
 
   WasmCode* code = owned_code.get();
   new_owned_code_.emplace_back(std::move(owned_code));
+  protected_instructions_size_.fetch_add(
+      code->protected_instructions_data().size(), std::memory_order_relaxed);
 
   // Add the code to the surrounding code ref scope, so the returned pointer is
   // guaranteed to be valid.
@@ -1488,6 +1573,12 @@ WasmModuleSourceMap* NativeModule::GetWasmSourceMap() const {
   return source_map_.get();
 }
 
+void NativeModule::SetLazilyDeserializedCode(
+    std::unique_ptr<LazilyDeserializedCode> code) {
+  DCHECK_NULL(lazily_deserialized_code_);
+  lazily_deserialized_code_ = std::move(code);
+}
+
 WasmCode* NativeModule::CreateEmptyJumpTableLocked(int jump_table_size,
                                                    JumpTableType type) {
   return CreateEmptyJumpTableInRegionLocked(jump_table_size,
@@ -2541,6 +2632,8 @@ void NativeModule::FreeCode(base::Vector<WasmCode* const> codes) {
   // Free the {WasmCode} objects. This will also unregister trap handler data.
   for (WasmCode* code : codes) {
     DCHECK_EQ(1, owned_code_.count(code->instruction_start()));
+    protected_instructions_size_.fetch_sub(
+        code->protected_instructions_data().size(), std::memory_order_relaxed);
     owned_code_.erase(code->instruction_start());
   }
   // Remove debug side tables for all removed code objects, after releasing our
@@ -2575,7 +2668,7 @@ NamesProvider* NativeModule::GetNamesProvider() {
 }
 
 size_t NativeModule::EstimateCurrentMemoryConsumption() const {
-  UPDATE_WHEN_CLASS_CHANGES(NativeModule, 552);
+  UPDATE_WHEN_CLASS_CHANGES(NativeModule, 568);
   size_t result = sizeof(NativeModule);
   result += module_->EstimateCurrentMemoryConsumption();
 
@@ -2587,6 +2680,9 @@ size_t NativeModule::EstimateCurrentMemoryConsumption() const {
   if (source_map_) {
     result += source_map_->EstimateCurrentMemoryConsumption();
   }
+  if (lazily_deserialized_code_) {
+    result += lazily_deserialized_code_->EstimateCurrentMemoryConsumption();
+  }
   result += compilation_state_->EstimateCurrentMemoryConsumption();
   result += import_wrapper_cache_.EstimateCurrentMemoryConsumption();
   // For {tiering_budgets_}.
@@ -2715,13 +2811,14 @@ std::pair<WasmCode*, SafepointEntry> WasmCodeManager::LookupCodeAndSafepoint(
         pc - WasmFrameConstants::kProtectedInstructionReturnAddressOffset);
     return !is_protected_instruction || code->for_debugging();
   };
-  if (!entry->safepoint_entry.is_initialized() && expect_safepoint()) {
+  // A cached safepoint entry implies that a safepoint was expected, so the
+  // cached path does not need to evaluate the condition again.
+  if (entry->safepoint_entry.is_initialized()) {
+    DCHECK(expect_safepoint());
+    DCHECK_EQ(entry->safepoint_entry, SafepointTable{code}.TryFindEntry(pc));
+  } else if (expect_safepoint()) {
     entry->safepoint_entry = SafepointTable{code}.TryFindEntry(pc);
     CHECK(entry->safepoint_entry.is_initialized());
-  } else if (expect_safepoint()) {
-    DCHECK_EQ(entry->safepoint_entry, SafepointTable{code}.TryFindEntry(pc));
-  } else {
-    DCHECK(!entry->safepoint_entry.is_initialized());
   }
   return std::make_pair(code, entry->safepoint_entry);
 }
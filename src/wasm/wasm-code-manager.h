@@ -45,6 +45,7 @@ namespace wasm {
 
 class AssumptionsJournal;
 class DebugInfo;
+class LazilyDeserializedCode;
 class NamesProvider;
 class NativeModule;
 struct WasmCompilationResult;
@@ -229,17 +230,31 @@ class V8_EXPORT_PRIVATE WasmCode final {
   // (otherwise debug side table positions would not match up).
   bool is_inspectable() const { return is_liftoff() && for_debugging(); }
 
+  // The protected instructions are stored as VLQ-encoded differences between
+  // consecutive instruction offsets, which are sorted (see
+  // {EncodeProtectedInstructions}). This is also the format in which they are
+  // serialized.
   base::Vector<const uint8_t> protected_instructions_data() const {
     return {meta_data_.get(),
             static_cast<size_t>(protected_instructions_size_)};
   }
 
-  base::Vector<const trap_handler::ProtectedInstructionData>
-  protected_instructions() const {
-    return base::Vector<const trap_handler::ProtectedInstructionData>::cast(
-        protected_instructions_data());
+  std::vector<trap_handler::ProtectedInstructionData> protected_instructions()
+      const {
+    return DecodeProtectedInstructions(protected_instructions_data());
   }
 
+  // Most memory accesses in Wasm code are protected instructions, and their
+  // offsets are mostly close to each other. Encoding the differences takes
+  // one or two bytes per instruction instead of four.
+  static base::OwnedVector<uint8_t> EncodeProtectedInstructions(
+      base::Vector<const trap_handler::ProtectedInstructionData> instructions);
+  static std::vector<trap_handler::ProtectedInstructionData>
+  DecodeProtectedInstructions(base::Vector<const uint8_t> data);
+
+  // Large tables get a sorted index of every
+  // {kProtectedInstructionsIndexStride}th offset on the first lookup, such that
+  // only the entries after the closest indexed one need to be decoded.
   bool IsProtectedInstruction(Address pc);
 
   void Validate() const;
@@ -392,15 +407,25 @@ class V8_EXPORT_PRIVATE WasmCode final {
   // Returns whether this code becomes dead and needs to be freed.
   V8_NOINLINE bool DecRefOnPotentiallyDeadCode();
 
+  struct ProtectedInstructionsIndex;
+  static constexpr int kProtectedInstructionsIndexStride = 32;
+  // Tables smaller than this are cheap enough to decode on every lookup.
+  static constexpr int kMinProtectedInstructionsSizeForIndex = 256;
+
+  const ProtectedInstructionsIndex* GetOrBuildProtectedInstructionsIndex();
+
   NativeModule* const native_module_ = nullptr;
   uint8_t* const instructions_;
   // {meta_data_} contains several byte vectors concatenated into one:
   //  - protected instructions data of size {protected_instructions_size_}
   //  - relocation info of size {reloc_info_size_}
   //  - source positions of size {source_positions_size_}
+  //  - inlining positions of size {inlining_positions_size_}
   //  - deopt data of size {deopt_data_size_}
-  // Note that the protected instructions come first to ensure alignment.
   std::unique_ptr<const uint8_t[]> meta_data_;
+  // Built by {IsProtectedInstruction}, which can run on several threads.
+  std::atomic<const ProtectedInstructionsIndex*> protected_instructions_index_{
+      nullptr};
   const int instructions_size_;
   const int reloc_info_size_;
   const int source_positions_size_;
@@ -609,6 +634,13 @@ class V8_EXPORT_PRIVATE NativeModule final {
   void SetWasmSourceMap(std::unique_ptr<WasmModuleSourceMap> source_map);
   WasmModuleSourceMap* GetWasmSourceMap() const;
 
+  // Installed by the deserializer before the module is shared with other
+  // isolates, not modified afterwards.
+  void SetLazilyDeserializedCode(std::unique_ptr<LazilyDeserializedCode> code);
+  LazilyDeserializedCode* lazily_deserialized_code() const {
+    return lazily_deserialized_code_.get();
+  }
+
   Address jump_table_start() const {
     return main_jump_table_ ? main_jump_table_->instruction_start()
                             : kNullAddress;
@@ -659,6 +691,10 @@ class V8_EXPORT_PRIVATE NativeModule final {
   size_t generated_code_size() const {
     return code_allocator_.generated_code_size();
   }
+  // The encoded protected instructions of all code owned by this module.
+  size_t protected_instructions_size() const {
+    return protected_instructions_size_.load(std::memory_order_relaxed);
+  }
   size_t liftoff_bailout_count() const {
     return liftoff_bailout_count_.load(std::memory_order_relaxed);
   }
@@ -937,6 +973,9 @@ class V8_EXPORT_PRIVATE NativeModule final {
 
   std::unique_ptr<WasmModuleSourceMap> source_map_;
 
+  // Serialized code of functions that get deserialized on their first call.
+  std::unique_ptr<LazilyDeserializedCode> lazily_deserialized_code_;
+
   // Wire bytes, held in a shared_ptr so they can be kept alive by the
   // {WireBytesStorage}, held by background compile tasks.
   std::shared_ptr<base::OwnedVector<const uint8_t>> wire_bytes_;
@@ -1011,6 +1050,7 @@ class V8_EXPORT_PRIVATE NativeModule final {
   std::atomic<size_t> liftoff_bailout_count_{0};
   std::atomic<size_t> liftoff_code_size_{0};
   std::atomic<size_t> turbofan_code_size_{0};
+  std::atomic<size_t> protected_instructions_size_{0};
 
   // Metrics for lazy compilation.
   std::atomic<int> num_lazy_compilations_{0};
@@ -36,6 +36,7 @@
 #include "src/wasm/wasm-debug.h"
 #include "src/wasm/wasm-limits.h"
 #include "src/wasm/wasm-objects-inl.h"
+#include "src/wasm/wasm-tiering-sampler.h"
 
 #if V8_ENABLE_DRUMBRAKE
 #include "src/wasm/interpreter/wasm-interpreter-inl.h"
@@ -511,6 +512,12 @@ struct WasmEngine::IsolateInfo {
   // TODO(wasm): Remove this once we can use the generic js-to-wasm wrapper
   // everywhere.
   std::shared_ptr<OperationsBarrier> wrapper_compilation_barrier_;
+
+  // Detects hot functions with --wasm-sampling-tier-up. Only set while the
+  // isolate uses native modules with Liftoff code, see
+  // {EnsureTieringSampler}. Shared with {ProcessTieringSamples}, which uses
+  // it outside of the {mutex_}.
+  std::shared_ptr<WasmTieringSampler> tiering_sampler;
 };
 
 void WasmEngine::ClearWeakScriptHandle(Isolate* isolate,
@@ -719,6 +726,11 @@ MaybeHandle<WasmInstanceObject> WasmEngine::SyncInstantiate(
     Handle<WasmModuleObject> module_object, MaybeHandle<JSReceiver> imports,
     MaybeHandle<JSArrayBuffer> memory) {
   TRACE_EVENT0("v8.wasm", "wasm.SyncInstantiate");
+  // Start sampling before the start function can run Liftoff code.
+  if (v8_flags.wasm_sampling_tier_up && v8_flags.liftoff &&
+      module_object->native_module()->compilation_state()->dynamic_tiering()) {
+    EnsureTieringSampler(isolate);
+  }
   return InstantiateToInstanceObject(isolate, thrower, module_object, imports,
                                      memory);
 }
@@ -997,7 +1009,7 @@ Handle<Script> CreateWasmScript(Isolate* isolate,
   // allocating a new {Managed<T>} that the {Script} references.
   size_t code_size_estimate = native_module->committed_code_space();
   size_t memory_estimate =
-      code_size_estimate +
+      code_size_estimate + native_module->protected_instructions_size() +
       wasm::WasmCodeManager::EstimateNativeModuleMetaDataSize(module);
   DirectHandle<Managed<wasm::NativeModule>> managed_native_module =
       Managed<wasm::NativeModule>::From(isolate, memory_estimate,
@@ -1587,6 +1599,9 @@ void WasmEngine::StreamingCompilationFailed(
 }
 
 void WasmEngine::FreeNativeModule(NativeModule* native_module) {
+  // Tiering samplers of isolates without native modules are stopped after
+  // releasing the {mutex_}, since that joins their sampling threads.
+  std::vector<std::shared_ptr<WasmTieringSampler>> samplers_to_stop;
   base::MutexGuard guard(&mutex_);
   auto module = native_modules_.find(native_module);
   DCHECK_NE(native_modules_.end(), module);
@@ -1599,6 +1614,9 @@ void WasmEngine::FreeNativeModule(NativeModule* native_module) {
     DCHECK_EQ(1, info->native_modules.count(native_module));
     info->native_modules.erase(native_module);
     info->scripts.erase(native_module);
+    if (info->native_modules.empty() && info->tiering_sampler) {
+      samplers_to_stop.push_back(std::move(info->tiering_sampler));
+    }
 
     // Flush the Wasm code lookup cache, since it may refer to some
     // code within native modules that we are going to release (if a
@@ -1717,6 +1735,33 @@ void WasmEngine::ReportLiveCodeFromStackForGC(Isolate* isolate) {
       isolate, base::OwnedVector<WasmCode*>::Of(live_wasm_code).as_vector());
 }
 
+void WasmEngine::EnsureTieringSampler(Isolate* isolate) {
+  DCHECK(v8_flags.wasm_sampling_tier_up);
+  {
+    base::MutexGuard guard(&mutex_);
+    if (isolates_[isolate]->tiering_sampler) return;
+  }
+  // The sampler samples the current thread, so this has to be called on the
+  // isolate's thread. That is also the only thread that creates samplers for
+  // the isolate, so nobody else can install one in the meantime. Starting the
+  // sampling thread does not need the {mutex_}.
+  auto tiering_sampler = std::make_shared<WasmTieringSampler>(isolate);
+  base::MutexGuard guard(&mutex_);
+  DCHECK_NULL(isolates_[isolate]->tiering_sampler);
+  isolates_[isolate]->tiering_sampler = std::move(tiering_sampler);
+}
+
+void WasmEngine::ProcessTieringSamples(Isolate* isolate) {
+  std::shared_ptr<WasmTieringSampler> tiering_sampler;
+  {
+    base::MutexGuard guard(&mutex_);
+    tiering_sampler = isolates_[isolate]->tiering_sampler;
+  }
+  // Keep the sampler alive even if the isolate's last native module dies
+  // meanwhile. Tier-up must not happen under the {mutex_}.
+  if (tiering_sampler) tiering_sampler->ProcessSamples();
+}
+
 bool WasmEngine::AddPotentiallyDeadCode(WasmCode* code) {
   base::MutexGuard guard(&mutex_);
   if (dead_code_.contains(code)) return false;  // Code is already dead.
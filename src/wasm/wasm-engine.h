@@ -369,6 +369,16 @@ class V8_EXPORT_PRIVATE WasmEngine {
   void ReportLiveCodeForGC(Isolate*, base::Vector<WasmCode*>);
   void ReportLiveCodeFromStackForGC(Isolate*);
 
+  // Start sampling for --wasm-sampling-tier-up, unless already running.
+  // Called on the isolate's thread before it runs Liftoff code. The sampler
+  // is stopped again once the isolate has no native modules left.
+  void EnsureTieringSampler(Isolate*);
+
+  // Attribute the samples taken for --wasm-sampling-tier-up to functions, and
+  // trigger tier-up of hot functions. Called on the isolate's thread via the
+  // {WASM_TIER_UP} interrupt.
+  void ProcessTieringSamples(Isolate*);
+
   // Add potentially dead code. The occurrence in the set of potentially dead
   // code counts as a reference, and is decremented on the next GC.
   // Returns {true} if the code was added to the set of potentially dead code,
@@ -81,6 +81,7 @@ Handle<WasmModuleObject> WasmModuleObject::New(
     const WasmModule* module = native_module->module();
     size_t memory_estimate =
         native_module->committed_code_space() +
+        native_module->protected_instructions_size() +
         wasm::WasmCodeManager::EstimateNativeModuleMetaDataSize(module);
     managed_native_module = Managed<wasm::NativeModule>::From(
         isolate, memory_estimate, std::move(native_module));
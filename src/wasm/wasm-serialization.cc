@@ -9,12 +9,14 @@
 #include "src/debug/debug.h"
 #include "src/runtime/runtime.h"
 #include "src/snapshot/snapshot-data.h"
+#include "src/tracing/trace-event.h"
 #include "src/utils/ostreams.h"
 #include "src/utils/version.h"
 #include "src/wasm/code-space-access.h"
 #include "src/wasm/function-compiler.h"
 #include "src/wasm/module-compiler.h"
 #include "src/wasm/module-decoder.h"
+#include "src/wasm/std-object-sizes.h"
 #include "src/wasm/wasm-code-manager.h"
 #include "src/wasm/wasm-engine.h"
 #include "src/wasm/wasm-module.h"
@@ -294,16 +296,26 @@ class V8_EXPORT_PRIVATE NativeModuleSerializer {
   bool Write(Writer* writer);
 
  private:
-  size_t MeasureCode(const WasmCode*) const;
+  size_t MeasureCode(const WasmCode*, uint32_t declared_index) const;
   void WriteHeader(Writer*, size_t total_code_size);
-  void WriteCode(const WasmCode*, Writer*);
+  void WriteCode(const WasmCode*, uint32_t declared_index, Writer*);
   void WriteTieringBudget(Writer* writer);
 
+  // The serialized record of a function without code that was never
+  // deserialized from the cache this module was loaded from, if any.
+  base::Vector<const uint8_t> GetLazyRecord(const WasmCode* code,
+                                            uint32_t declared_index) const;
+
   uint32_t CanonicalTypeIdToModuleLocalTypeId(uint32_t canonical_type_id);
 
   const NativeModule* const native_module_;
   const base::Vector<WasmCode* const> code_table_;
   const base::Vector<WellKnownImport const> import_statuses_;
+  // The records of functions without code that were not deserialized yet when
+  // this serializer was created, indexed by declared function index. Keeps
+  // them alive while serializing.
+  std::vector<std::shared_ptr<const LazilyDeserializedCode::Data>>
+      lazy_records_;
   // Map back canonical type IDs to module-local type IDs. Initialized lazily.
   std::unordered_map<uint32_t, uint32_t>
       canonical_type_ids_to_module_local_ids_;
@@ -319,11 +331,30 @@ NativeModuleSerializer::NativeModuleSerializer(
       code_table_(code_table),
       import_statuses_(import_statuses) {
   DCHECK_NOT_NULL(native_module_);
+  if (LazilyDeserializedCode* lazy_code =
+          native_module_->lazily_deserialized_code()) {
+    lazy_records_.resize(code_table_.size());
+    for (uint32_t i = 0; i < code_table_.size(); ++i) {
+      if (code_table_[i] == nullptr) lazy_records_[i] = lazy_code->GetRecord(i);
+    }
+  }
   // TODO(mtrofin): persist the export wrappers. Ideally, we'd only persist
   // the unique ones, i.e. the cache.
 }
 
-size_t NativeModuleSerializer::MeasureCode(const WasmCode* code) const {
+base::Vector<const uint8_t> NativeModuleSerializer::GetLazyRecord(
+    const WasmCode* code, uint32_t declared_index) const {
+  if (code != nullptr || lazy_records_.empty()) return {};
+  const std::shared_ptr<const LazilyDeserializedCode::Data>& record =
+      lazy_records_[declared_index];
+  if (record == nullptr) return {};
+  return record->as_vector();
+}
+
+size_t NativeModuleSerializer::MeasureCode(const WasmCode* code,
+                                           uint32_t declared_index) const {
+  base::Vector<const uint8_t> lazy_record = GetLazyRecord(code, declared_index);
+  if (!lazy_record.empty()) return lazy_record.size();
   if (code == nullptr) return sizeof(uint8_t);
   DCHECK_EQ(WasmCode::kWasmFunction, code->kind());
   if (code->tier() != ExecutionTier::kTurbofan) {
@@ -337,8 +368,8 @@ size_t NativeModuleSerializer::MeasureCode(const WasmCode* code) const {
 
 size_t NativeModuleSerializer::Measure() const {
   size_t size = kHeaderSize;
-  for (WasmCode* code : code_table_) {
-    size += MeasureCode(code);
+  for (uint32_t i = 0; i < code_table_.size(); ++i) {
+    size += MeasureCode(code_table_[i], i);
   }
   // Add the size of the well-known imports status.
   size += import_statuses_.size() * sizeof(WellKnownImport);
@@ -381,7 +412,19 @@ void NativeModuleSerializer::WriteHeader(Writer* writer,
   writer->WriteVector(base::VectorOf(import_statuses_));
 }
 
-void NativeModuleSerializer::WriteCode(const WasmCode* code, Writer* writer) {
+void NativeModuleSerializer::WriteCode(const WasmCode* code,
+                                       uint32_t declared_index,
+                                       Writer* writer) {
+  base::Vector<const uint8_t> lazy_record = GetLazyRecord(code, declared_index);
+  if (!lazy_record.empty()) {
+    // The record is still in serialized form, so copy it as is.
+    DCHECK_EQ(kTurboFanFunction, lazy_record[0]);
+    ++num_turbofan_functions_;
+    writer->WriteVector(lazy_record);
+    total_written_code_ +=
+        native_module_->lazily_deserialized_code()->GetCodeSize(declared_index);
+    return;
+  }
   if (code == nullptr) {
     writer->Write(kLazyFunction);
     return;
@@ -551,17 +594,22 @@ bool NativeModuleSerializer::Write(Writer* writer) {
   DCHECK(!write_called_);
   write_called_ = true;
 
+  LazilyDeserializedCode* lazy_code =
+      native_module_->lazily_deserialized_code();
   size_t total_code_size = 0;
-  for (WasmCode* code : code_table_) {
+  for (uint32_t i = 0; i < code_table_.size(); ++i) {
+    WasmCode* code = code_table_[i];
     if (code && code->tier() == ExecutionTier::kTurbofan) {
       DCHECK(IsAligned(code->instructions().size(), kCodeAlignment));
       total_code_size += code->instructions().size();
+    } else if (!GetLazyRecord(code, i).empty()) {
+      total_code_size += lazy_code->GetCodeSize(i);
     }
   }
   WriteHeader(writer, total_code_size);
 
-  for (WasmCode* code : code_table_) {
-    WriteCode(code, writer);
+  for (uint32_t i = 0; i < code_table_.size(); ++i) {
+    WriteCode(code_table_[i], i, writer);
   }
   // No TurboFan-compiled functions in jitless mode.
   if (!v8_flags.wasm_jitless) {
@@ -648,12 +696,19 @@ class DeserializationQueue {
 
 class V8_EXPORT_PRIVATE NativeModuleDeserializer {
  public:
-  explicit NativeModuleDeserializer(NativeModule*);
+  // If {lazy_code} is given, TurboFan code is not deserialized up front but
+  // recorded there for deserialization on the first call.
+  explicit NativeModuleDeserializer(
+      NativeModule*, LazilyDeserializedCode* lazy_code = nullptr);
   NativeModuleDeserializer(const NativeModuleDeserializer&) = delete;
   NativeModuleDeserializer& operator=(const NativeModuleDeserializer&) = delete;
 
   bool Read(Reader* reader);
 
+  // Deserializes and publishes a single function from its {record}.
+  WasmCode* ReadFunction(int fn_index, base::Vector<const uint8_t> record,
+                         size_t code_size);
+
   base::Vector<const int> lazy_functions() {
     return base::VectorOf(lazy_functions_);
   }
@@ -672,6 +727,7 @@ class V8_EXPORT_PRIVATE NativeModuleDeserializer {
   void Publish(std::vector<DeserializationUnit> batch);
 
   NativeModule* const native_module_;
+  LazilyDeserializedCode* const lazy_code_;
 #ifdef DEBUG
   bool read_called_ = false;
 #endif
@@ -747,8 +803,9 @@ class DeserializeCodeTask : public JobTask {
   std::atomic<bool> publishing_{false};
 };
 
-NativeModuleDeserializer::NativeModuleDeserializer(NativeModule* native_module)
-    : native_module_(native_module) {}
+NativeModuleDeserializer::NativeModuleDeserializer(
+    NativeModule* native_module, LazilyDeserializedCode* lazy_code)
+    : native_module_(native_module), lazy_code_(lazy_code) {}
 
 bool NativeModuleDeserializer::Read(Reader* reader) {
   DCHECK(!read_called_);
@@ -839,6 +896,7 @@ void NativeModuleDeserializer::ReadHeader(Reader* reader) {
 
 DeserializationUnit NativeModuleDeserializer::ReadCode(int fn_index,
                                                        Reader* reader) {
+  const uint8_t* record_start = reader->current_location();
   uint8_t code_kind = reader->Read<uint8_t>();
   if (code_kind == kLazyFunction) {
     lazy_functions_.push_back(fn_index);
@@ -870,6 +928,27 @@ DeserializationUnit NativeModuleDeserializer::ReadCode(int fn_index,
 
   DCHECK(IsAligned(code_size, kCodeAlignment));
   DCHECK_GE(remaining_code_size_, code_size);
+
+  if (lazy_code_ != nullptr) {
+    // Only keep a copy of the record; the jump table slot keeps pointing to
+    // the lazy compile stub until the function gets called.
+    reader->Skip(code_size + reloc_size + source_position_size +
+                 inlining_position_size + deopt_data_size +
+                 protected_instructions_size);
+    remaining_code_size_ -= code_size;
+    LazilyDeserializedCode::Record& record =
+        lazy_code_->records_[declared_function_index(native_module_->module(),
+                                                     fn_index)];
+    base::Vector<const uint8_t> record_bytes = base::VectorOf(
+        record_start,
+        static_cast<size_t>(reader->current_location() - record_start));
+    record.data = std::make_shared<const LazilyDeserializedCode::Data>(
+        LazilyDeserializedCode::Data::Of(record_bytes));
+    record.code_size = static_cast<uint32_t>(code_size);
+    lazy_code_->unused_records_size_ += record_bytes.size();
+    lazy_functions_.push_back(fn_index);
+    return {};
+  }
   if (current_code_space_.size() < static_cast<size_t>(code_size)) {
     // Allocate the next code space. Don't allocate more than 90% of
     // {kMaxCodeSpaceSize}, to leave some space for jump tables.
@@ -974,6 +1053,21 @@ void NativeModuleDeserializer::CopyAndRelocate(
                         unit.code->instructions().size());
 }
 
+WasmCode* NativeModuleDeserializer::ReadFunction(
+    int fn_index, base::Vector<const uint8_t> record, size_t code_size) {
+  DCHECK_NULL(lazy_code_);
+  remaining_code_size_ = code_size;
+  Reader reader(record);
+  DeserializationUnit unit = ReadCode(fn_index, &reader);
+  DCHECK_EQ(0, reader.current_size());
+  DCHECK_EQ(0, remaining_code_size_);
+  CopyAndRelocate(unit);
+  WasmCode* code = native_module_->PublishCode(std::move(unit.code));
+  code->MaybePrint();
+  code->Validate();
+  return code;
+}
+
 void NativeModuleDeserializer::ReadTieringBudget(Reader* reader) {
   size_t size_of_tiering_budget =
       native_module_->module()->num_declared_functions * sizeof(uint32_t);
@@ -1001,6 +1095,48 @@ void NativeModuleDeserializer::Publish(std::vector<DeserializationUnit> batch) {
   }
 }
 
+LazilyDeserializedCode::LazilyDeserializedCode(
+    uint32_t num_declared_functions)
+    : records_(num_declared_functions) {}
+
+std::shared_ptr<const LazilyDeserializedCode::Data>
+LazilyDeserializedCode::GetRecord(uint32_t declared_index) const {
+  base::MutexGuard guard(&mutex_);
+  return records_[declared_index].data;
+}
+
+WasmCode* LazilyDeserializedCode::DeserializeFunction(
+    NativeModule* native_module, int func_index, bool* deserialized) {
+  *deserialized = false;
+  uint32_t declared_index =
+      declared_function_index(native_module->module(), func_index);
+  // Hold the lock while deserializing, so that concurrent first calls do not
+  // copy the same code twice. Those calls return the published code instead.
+  base::MutexGuard guard(&mutex_);
+  Record& record = records_[declared_index];
+  if (record.used) return native_module->GetCode(func_index);
+  if (record.data == nullptr) return nullptr;
+  record.used = true;
+  // Release the record once it was read. Serializers that still hold it keep
+  // it alive.
+  std::shared_ptr<const Data> data = std::move(record.data);
+  DCHECK_LE(data->size(), unused_records_size_);
+  unused_records_size_ -= data->size();
+  TRACE_EVENT1("v8.wasm", "wasm.DeserializeLazyFunction", "func_index",
+               func_index);
+  NativeModuleDeserializer deserializer(native_module);
+  WasmCode* code = deserializer.ReadFunction(func_index, data->as_vector(),
+                                             record.code_size);
+  *deserialized = true;
+  return code;
+}
+
+size_t LazilyDeserializedCode::EstimateCurrentMemoryConsumption() const {
+  base::MutexGuard guard(&mutex_);
+  return sizeof(LazilyDeserializedCode) + ContentSize(records_) +
+         unused_records_size_;
+}
+
 bool IsSupportedVersion(base::Vector<const uint8_t> header,
                         WasmEnabledFeatures enabled_features) {
   if (header.size() < WasmSerializer::kHeaderSize) return false;
@@ -1054,7 +1190,16 @@ MaybeHandle<WasmModuleObject> DeserializeNativeModule(
     shared_native_module->compilation_state()->set_compilation_id(-2);
     shared_native_module->SetWireBytes(std::move(owned_wire_bytes));
 
-    NativeModuleDeserializer deserializer(shared_native_module.get());
+    // With lazy deserialization, the deserializer keeps copies of the records
+    // of TurboFan functions: they are read on their first call, or when
+    // serializing again.
+    std::unique_ptr<LazilyDeserializedCode> lazy_code;
+    if (v8_flags.wasm_lazy_deserialization) {
+      lazy_code = std::make_unique<LazilyDeserializedCode>(
+          shared_native_module->module()->num_declared_functions);
+    }
+    NativeModuleDeserializer deserializer(shared_native_module.get(),
+                                          lazy_code.get());
     Reader reader(data + WasmSerializer::kHeaderSize);
     bool error = !deserializer.Read(&reader);
     if (error) {
@@ -1062,6 +1207,9 @@ MaybeHandle<WasmModuleObject> DeserializeNativeModule(
           error, std::move(shared_native_module), isolate);
       return {};
     }
+    if (lazy_code) {
+      shared_native_module->SetLazilyDeserializedCode(std::move(lazy_code));
+    }
     shared_native_module->compilation_state()->InitializeAfterDeserialization(
         deserializer.lazy_functions(), deserializer.eager_functions());
     wasm_engine->UpdateNativeModuleCache(error, shared_native_module, isolate);
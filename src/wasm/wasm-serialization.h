@@ -9,6 +9,7 @@
 #ifndef V8_WASM_WASM_SERIALIZATION_H_
 #define V8_WASM_WASM_SERIALIZATION_H_
 
+#include "src/base/platform/mutex.h"
 #include "src/wasm/wasm-code-manager.h"
 #include "src/wasm/wasm-objects.h"
 
@@ -52,6 +53,59 @@ class V8_EXPORT_PRIVATE WasmSerializer {
   std::vector<WellKnownImport> import_statuses_;
 };
 
+// Serialized TurboFan code of the functions of a deserialized {NativeModule}
+// that were left for deserialization on their first call
+// (--wasm-lazy-deserialization). Their jump table slots keep pointing to the
+// lazy compile stub, which deserializes them instead of compiling them. Each
+// record is copied out of the serialized module on its own and released once
+// its function was deserialized. The {NativeModule} keeps the other records,
+// so that serializing the module again can copy records of functions that
+// never ran instead of dropping them.
+class V8_EXPORT_PRIVATE LazilyDeserializedCode {
+ public:
+  using Data = base::OwnedVector<const uint8_t>;
+
+  explicit LazilyDeserializedCode(uint32_t num_declared_functions);
+  LazilyDeserializedCode(const LazilyDeserializedCode&) = delete;
+  LazilyDeserializedCode& operator=(const LazilyDeserializedCode&) = delete;
+
+  // The serialized record of the function with the given declared function
+  // index, or {nullptr} if there is none or it was deserialized already.
+  // Holding the result keeps the record alive.
+  std::shared_ptr<const Data> GetRecord(uint32_t declared_index) const;
+
+  // Size of the machine code in the record of the given function.
+  size_t GetCodeSize(uint32_t declared_index) const {
+    return records_[declared_index].code_size;
+  }
+
+  // Deserializes and publishes the code of {func_index} if its record was not
+  // used yet. If another caller deserialized it already, returns the published
+  // code and sets {*deserialized} to false. Returns {nullptr} if there is no
+  // record, in which case the caller compiles the function as usual.
+  WasmCode* DeserializeFunction(NativeModule* native_module, int func_index,
+                                bool* deserialized);
+
+  size_t EstimateCurrentMemoryConsumption() const;
+
+ private:
+  friend class NativeModuleDeserializer;
+
+  struct Record {
+    // Released when the function gets deserialized.
+    std::shared_ptr<const Data> data;
+    uint32_t code_size = 0;
+    bool used = false;
+  };
+
+  // Indexed by declared function index. Only {data} and {used} change after
+  // deserialization of the module, protected by {mutex_}.
+  std::vector<Record> records_;
+  // The total size of the records that were not deserialized yet.
+  size_t unused_records_size_ = 0;
+  mutable base::Mutex mutex_;
+};
+
 // Support for deserializing WebAssembly {NativeModule} objects.
 // Checks the version header of the data against the current version.
 bool IsSupportedVersion(base::Vector<const uint8_t> data,
@@ -0,0 +1,164 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/wasm/wasm-tiering-sampler.h"
+
+#include "include/v8-unwinder.h"
+#include "src/base/platform/platform.h"
+#include "src/base/platform/time.h"
+#include "src/execution/frames-inl.h"
+#include "src/execution/isolate.h"
+#include "src/execution/v8threads.h"
+#include "src/libsampler/sampler.h"
+#include "src/logging/counters.h"
+#include "src/profiler/tick-sample.h"
+#include "src/wasm/module-compiler.h"
+#include "src/wasm/wasm-code-manager.h"
+#include "src/wasm/wasm-objects-inl.h"
+
+namespace v8::internal::wasm {
+
+class WasmTieringSampler::PcSampler : public sampler::Sampler {
+ public:
+  PcSampler(Isolate* isolate, WasmTieringSampler* owner)
+      : sampler::Sampler(reinterpret_cast<v8::Isolate*>(isolate)),
+        owner_(owner),
+        per_thread_data_(isolate->FindPerThreadDataForThisThread()) {}
+
+  void SampleStack(const v8::RegisterState& state) override {
+    Isolate* isolate = reinterpret_cast<Isolate*>(this->isolate());
+    if (isolate->was_locker_ever_used() &&
+        (!isolate->thread_manager()->IsLockedByThread(
+             per_thread_data_->thread_id()) ||
+         per_thread_data_->thread_state() != nullptr)) {
+      return;
+    }
+    // Only the innermost JavaScript or Wasm frame is needed. If the thread is
+    // in a runtime function or builtin called from Wasm, this attributes the
+    // sample to the calling Wasm function.
+    v8::RegisterState regs = state;
+    void* frames[1];
+    v8::SampleInfo info;
+    if (!TickSample::GetStackSample(isolate, &regs,
+                                    TickSample::kSkipCEntryFrame, frames,
+                                    arraysize(frames), &info)) {
+      return;
+    }
+    if (info.frames_count == 0) return;
+    owner_->RecordSample(reinterpret_cast<Address>(frames[0]));
+  }
+
+ private:
+  WasmTieringSampler* const owner_;
+  Isolate::PerIsolateThreadData* const per_thread_data_;
+};
+
+class WasmTieringSampler::SamplingThread : public base::Thread {
+ public:
+  static constexpr int kSamplingThreadStackSize = 64 * KB;
+
+  explicit SamplingThread(WasmTieringSampler* owner)
+      : base::Thread(base::Thread::Options("WasmTieringSampler",
+                                           kSamplingThreadStackSize)),
+        owner_(owner) {}
+
+  void Run() override {
+    const base::TimeDelta interval = base::TimeDelta::FromMicroseconds(
+        v8_flags.wasm_sampling_tier_up_interval);
+    while (owner_->sampler_->IsActive()) {
+      owner_->sampler_->DoSample();
+      if (owner_->NumPendingSamples() >= kSamplesPerInterrupt) {
+        owner_->isolate_->stack_guard()->RequestWasmTierUp();
+      }
+      base::OS::Sleep(interval);
+    }
+  }
+
+ private:
+  WasmTieringSampler* const owner_;
+};
+
+WasmTieringSampler::WasmTieringSampler(Isolate* isolate)
+    : isolate_(isolate),
+      sampler_(std::make_unique<PcSampler>(isolate, this)),
+      sampling_thread_(std::make_unique<SamplingThread>(this)) {
+  sampler_->Start();
+  CHECK(sampling_thread_->StartSynchronously());
+}
+
+WasmTieringSampler::~WasmTieringSampler() {
+  sampler_->Stop();
+  sampling_thread_->Join();
+}
+
+void WasmTieringSampler::RecordSample(Address pc) {
+  uint32_t end = samples_end_.load(std::memory_order_relaxed);
+  if (end - samples_start_.load(std::memory_order_acquire) ==
+      kMaxPendingSamples) {
+    return;
+  }
+  samples_[end % kMaxPendingSamples].store(pc, std::memory_order_relaxed);
+  samples_end_.store(end + 1, std::memory_order_release);
+}
+
+uint32_t WasmTieringSampler::NumPendingSamples() const {
+  return samples_end_.load(std::memory_order_acquire) -
+         samples_start_.load(std::memory_order_relaxed);
+}
+
+void WasmTieringSampler::ProcessSamples() {
+  // Copy the samples out first; more samples can be recorded while we process
+  // them.
+  Address pcs[kMaxPendingSamples];
+  uint32_t start = samples_start_.load(std::memory_order_relaxed);
+  uint32_t end = samples_end_.load(std::memory_order_acquire);
+  uint32_t num_samples = end - start;
+  for (uint32_t i = 0; i < num_samples; ++i) {
+    pcs[i] = samples_[(start + i) % kMaxPendingSamples].load(
+        std::memory_order_relaxed);
+  }
+  samples_start_.store(end, std::memory_order_release);
+
+  const int threshold = v8_flags.wasm_sampling_tier_up_threshold;
+  {
+    WasmCodeRefScope code_ref_scope;
+    for (uint32_t i = 0; i < num_samples; ++i) {
+      // The code lookup cache is not used, since the sampled code might have
+      // died in the meantime.
+      WasmCode* code = GetWasmCodeManager()->LookupCode(pcs[i]);
+      if (code == nullptr || !code->is_liftoff() || code->for_debugging()) {
+        continue;
+      }
+      FunctionKey key{code->native_module(), code->index()};
+      if (++sample_counts_[key] == threshold) hot_functions_.insert(key);
+    }
+  }
+
+  if (!hot_functions_.empty()) TriggerTierUpOnStack();
+
+  samples_in_period_ += num_samples;
+  if (samples_in_period_ >= kSamplesPerPeriod) {
+    sample_counts_.clear();
+    hot_functions_.clear();
+    samples_in_period_ = 0;
+  }
+}
+
+void WasmTieringSampler::TriggerTierUpOnStack() {
+  DisallowGarbageCollection no_gc;
+  for (StackFrameIterator it(isolate_); !it.done(); it.Advance()) {
+    if (it.frame()->type() != StackFrame::WASM) continue;
+    WasmFrame* frame = WasmFrame::cast(it.frame());
+    WasmCode* code = frame->wasm_code();
+    if (!code->is_liftoff()) continue;
+    auto hot = hot_functions_.find({code->native_module(), code->index()});
+    if (hot == hot_functions_.end()) continue;
+    hot_functions_.erase(hot);
+    isolate_->counters()->wasm_sampled_tier_ups()->Increment();
+    TriggerTierUp(isolate_, frame->trusted_instance_data(), code->index());
+    if (hot_functions_.empty()) break;
+  }
+}
+
+}  // namespace v8::internal::wasm
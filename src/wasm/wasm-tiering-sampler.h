@@ -0,0 +1,90 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#if !V8_ENABLE_WEBASSEMBLY
+#error This header should only be included if WebAssembly is enabled.
+#endif  // !V8_ENABLE_WEBASSEMBLY
+
+#ifndef V8_WASM_WASM_TIERING_SAMPLER_H_
+#define V8_WASM_WASM_TIERING_SAMPLER_H_
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <set>
+#include <utility>
+
+#include "src/common/globals.h"
+
+namespace v8::internal {
+
+class Isolate;
+
+namespace wasm {
+
+class NativeModule;
+
+// Detects hot Liftoff functions by periodically sampling the program counter
+// of an isolate's thread, instead of decrementing tiering budgets in Liftoff
+// code (--wasm-sampling-tier-up).
+// Samples are only recorded in the signal handler. They are attributed to
+// functions on the isolate's thread when it handles the {WASM_TIER_UP}
+// interrupt, which also triggers tier-up of all functions which have been
+// sampled often enough.
+class WasmTieringSampler {
+ public:
+  explicit WasmTieringSampler(Isolate* isolate);
+  ~WasmTieringSampler();
+
+  WasmTieringSampler(const WasmTieringSampler&) = delete;
+  WasmTieringSampler& operator=(const WasmTieringSampler&) = delete;
+
+  // Processes outstanding samples; called on the isolate's thread.
+  void ProcessSamples();
+
+ private:
+  class PcSampler;
+  class SamplingThread;
+
+  // The number of samples that can be recorded before they get processed;
+  // additional samples are dropped.
+  static constexpr uint32_t kMaxPendingSamples = 256;
+  // The number of pending samples at which the sampling thread requests the
+  // {WASM_TIER_UP} interrupt.
+  static constexpr uint32_t kSamplesPerInterrupt = 16;
+  // Sample counts are reset after this many samples, such that functions need
+  // to be sampled frequently (not just often) to get tiered up.
+  static constexpr int kSamplesPerPeriod = 4096;
+
+  using FunctionKey = std::pair<NativeModule*, int>;
+
+  // Called in the signal handler.
+  void RecordSample(Address pc);
+  uint32_t NumPendingSamples() const;
+
+  // Triggers tier-up of hot functions which have a frame on the stack (we need
+  // the frame to find the instance for processing type feedback).
+  void TriggerTierUpOnStack();
+
+  Isolate* const isolate_;
+  std::unique_ptr<PcSampler> sampler_;
+  std::unique_ptr<SamplingThread> sampling_thread_;
+
+  // Ring buffer of sampled pcs. {samples_end_} is only written in the signal
+  // handler, {samples_start_} only on the isolate's thread.
+  std::atomic<Address> samples_[kMaxPendingSamples];
+  std::atomic<uint32_t> samples_start_{0};
+  std::atomic<uint32_t> samples_end_{0};
+
+  // Only accessed on the isolate's thread. Entries can refer to dead native
+  // modules; they are just dropped at the end of the period.
+  std::map<FunctionKey, int> sample_counts_;
+  std::set<FunctionKey> hot_functions_;
+  int samples_in_period_ = 0;
+};
+
+}  // namespace wasm
+}  // namespace v8::internal
+
+#endif  // V8_WASM_WASM_TIERING_SAMPLER_H_
@@ -76,6 +76,42 @@ const char* WellKnownImportName(WellKnownImport wki) {
     case WellKnownImport::kStringToLowerCaseImported:
       return "String.toLowerCase";
 
+      // Math functions:
+    case WellKnownImport::kMathAbs:
+      return "Math.abs";
+    case WellKnownImport::kMathAcos:
+      return "Math.acos";
+    case WellKnownImport::kMathAsin:
+      return "Math.asin";
+    case WellKnownImport::kMathAtan:
+      return "Math.atan";
+    case WellKnownImport::kMathAtan2:
+      return "Math.atan2";
+    case WellKnownImport::kMathCeil:
+      return "Math.ceil";
+    case WellKnownImport::kMathCos:
+      return "Math.cos";
+    case WellKnownImport::kMathExp:
+      return "Math.exp";
+    case WellKnownImport::kMathFloor:
+      return "Math.floor";
+    case WellKnownImport::kMathFround:
+      return "Math.fround";
+    case WellKnownImport::kMathLog:
+      return "Math.log";
+    case WellKnownImport::kMathMax:
+      return "Math.max";
+    case WellKnownImport::kMathMin:
+      return "Math.min";
+    case WellKnownImport::kMathPow:
+      return "Math.pow";
+    case WellKnownImport::kMathSin:
+      return "Math.sin";
+    case WellKnownImport::kMathSqrt:
+      return "Math.sqrt";
+    case WellKnownImport::kMathTan:
+      return "Math.tan";
+
       // JS String Builtins:
     case WellKnownImport::kStringCast:
       return "js-string:cast";
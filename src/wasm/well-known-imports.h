@@ -88,6 +88,27 @@ enum class WellKnownImport : uint8_t {
   kStringToLocaleLowerCaseStringref,
   kStringToLowerCaseStringref,
   kStringToLowerCaseImported,
+
+  // Math functions, if the import's signature matches the corresponding Wasm
+  // instruction (e.g. Math.sqrt as (f64) -> f64 or (f32) -> f32):
+  kMathAbs,
+  kMathAcos,
+  kMathAsin,
+  kMathAtan,
+  kMathAtan2,
+  kMathCeil,
+  kMathCos,
+  kMathExp,
+  kMathFloor,
+  kMathFround,
+  kMathLog,
+  kMathMax,
+  kMathMin,
+  kMathPow,
+  kMathSin,
+  kMathSqrt,
+  kMathTan,
+
   // Fast API calls:
   kFastAPICall,
 };
@@ -0,0 +1,124 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <string>
+
+#include "include/v8-context.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-persistent-handle.h"
+#include "include/v8-primitive.h"
+#include "include/v8-script.h"
+#include "test/benchmarks/cpp/benchmark-utils.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace {
+
+// Source resembling a minified bundle with many long string literals.
+std::string StringLiteralsSource() {
+  std::string source;
+  for (int i = 0; i < 1000; i++) {
+    source += "var s" + std::to_string(i) + "='";
+    for (int j = 0; j < 40; j++) source += "lorem ipsum dolor sit amet ";
+    source += "\\n';\n";
+  }
+  return source;
+}
+
+// Source with string literals that leave the ASCII fast path often, through
+// escape sequences and non-ASCII characters.
+std::string EscapedStringLiteralsSource() {
+  std::string source;
+  for (int i = 0; i < 1000; i++) {
+    source += "var e" + std::to_string(i) + "=\"";
+    for (int j = 0; j < 20; j++) {
+      source += "lorem \\\"ipsum\\\" dolor\\tsit \xC3\xA4met ";
+    }
+    source += "\";\n";
+  }
+  return source;
+}
+
+// Source where most of the bytes are in single-line comments.
+std::string SingleLineCommentsSource() {
+  std::string source;
+  for (int i = 0; i < 1000; i++) {
+    for (int j = 0; j < 10; j++) {
+      source += "// Lorem ipsum dolor sit amet, consectetur adipiscing elit.\n";
+    }
+    source += "var c" + std::to_string(i) + " = " + std::to_string(i) + ";\n";
+  }
+  return source;
+}
+
+// Source where most of the bytes are in multi-line comments.
+std::string MultiLineCommentsSource() {
+  std::string source;
+  for (int i = 0; i < 1000; i++) {
+    source += "/*\n";
+    for (int j = 0; j < 10; j++) {
+      source += " * Lorem ipsum dolor sit amet, consectetur adipiscing elit.\n";
+    }
+    source += " */\n";
+    source += "var c" + std::to_string(i) + " = " + std::to_string(i) + ";\n";
+  }
+  return source;
+}
+
+class ParsingBenchmark : public v8::benchmarking::BenchmarkWithIsolate {
+ public:
+  void SetUp(::benchmark::State& state) override {
+    v8::HandleScope handle_scope(v8_isolate());
+    context_.Reset(v8_isolate(), v8::Context::New(v8_isolate()));
+  }
+
+  void TearDown(::benchmark::State& state) override { context_.Reset(); }
+
+ protected:
+  void CompileRepeatedly(::benchmark::State& state, const std::string& body) {
+    v8::HandleScope handle_scope(v8_isolate());
+    v8::Local<v8::Context> context = context_.Get(v8_isolate());
+    v8::Context::Scope context_scope(context);
+
+    int iteration = 0;
+    for (auto _ : state) {
+      v8::HandleScope iteration_scope(v8_isolate());
+      // Make every source unique so that the compilation cache doesn't hit.
+      std::string source = "// " + std::to_string(iteration++) + "\n" + body;
+      v8::Local<v8::String> source_string =
+          v8::String::NewFromUtf8(v8_isolate(), source.c_str(),
+                                  v8::NewStringType::kNormal,
+                                  static_cast<int>(source.length()))
+              .ToLocalChecked();
+      v8::ScriptCompiler::Source script_source(source_string);
+      v8::Local<v8::UnboundScript> script =
+          v8::ScriptCompiler::CompileUnboundScript(v8_isolate(),
+                                                   &script_source)
+              .ToLocalChecked();
+      benchmark::DoNotOptimize(script);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(body.length()));
+  }
+
+ private:
+  v8::Global<v8::Context> context_;
+};
+
+}  // namespace
+
+BENCHMARK_F(ParsingBenchmark, StringLiterals)(benchmark::State& st) {
+  CompileRepeatedly(st, StringLiteralsSource());
+}
+
+BENCHMARK_F(ParsingBenchmark, EscapedStringLiterals)(benchmark::State& st) {
+  CompileRepeatedly(st, EscapedStringLiteralsSource());
+}
+
+BENCHMARK_F(ParsingBenchmark, SingleLineComments)(benchmark::State& st) {
+  CompileRepeatedly(st, SingleLineCommentsSource());
+}
+
+BENCHMARK_F(ParsingBenchmark, MultiLineComments)(benchmark::State& st) {
+  CompileRepeatedly(st, MultiLineCommentsSource());
+}
@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 #include "src/base/utils/random-number-generator.h"
+#include "src/flags/flags.h"
 #include "src/ic/accessor-assembler.h"
 #include "src/ic/stub-cache.h"
 #include "src/objects/objects-inl.h"
@@ -27,18 +28,19 @@ void TestStubCacheOffsetCalculation(StubCache::Table table) {
   const int kNumParams = 2;
   CodeAssemblerTester data(isolate, JSParameterCount(kNumParams));
   AccessorAssembler m(data.state());
+  StubCache* stub_cache = isolate->load_stub_cache();
 
   {
     auto name = m.Parameter<Name>(1);
     auto map = m.Parameter<Map>(2);
     TNode<IntPtrT> primary_offset =
-        m.StubCachePrimaryOffsetForTesting(name, map);
+        m.StubCachePrimaryOffsetForTesting(stub_cache, name, map);
     TNode<IntPtrT> result;
     if (table == StubCache::kPrimary) {
       result = primary_offset;
     } else {
       CHECK_EQ(StubCache::kSecondary, table);
-      result = m.StubCacheSecondaryOffsetForTesting(name, map);
+      result = m.StubCacheSecondaryOffsetForTesting(stub_cache, name, map);
     }
     m.Return(m.SmiTag(result));
   }
@@ -75,11 +77,11 @@ void TestStubCacheOffsetCalculation(StubCache::Table table) {
 
       int expected_result;
       {
-        int primary_offset = StubCache::PrimaryOffsetForTesting(*name, *map);
+        int primary_offset = stub_cache->PrimaryOffsetForTesting(*name, *map);
         if (table == StubCache::kPrimary) {
           expected_result = primary_offset;
         } else {
-          expected_result = StubCache::SecondaryOffsetForTesting(*name, *map);
+          expected_result = stub_cache->SecondaryOffsetForTesting(*name, *map);
         }
       }
       DirectHandle<Object> result = ft.Call(name, map).ToHandleChecked();
@@ -252,6 +254,48 @@ TEST(TryProbeStubCache) {
   CHECK(queried_existing && queried_non_existing);
 }
 
+TEST(StubCacheGrows) {
+  FlagScope<bool> stub_cache_resize(&v8_flags.stub_cache_resize, true);
+  Isolate* isolate(CcTest::InitIsolateOnce());
+  Factory* factory = isolate->factory();
+  StubCache stub_cache(isolate);
+  stub_cache.Clear();
+  CHECK_EQ(StubCache::kPrimaryTableSize, stub_cache.primary_table_size());
+  CHECK_EQ(StubCache::kSecondaryTableSize, stub_cache.secondary_table_size());
+
+  std::vector<Handle<Map>> maps;
+  for (int i = 0; i < 4 * StubCache::kPrimaryTableSize; i++) {
+    maps.push_back(Map::Create(isolate, 0));
+  }
+  Handle<Name> name = factory->InternalizeUtf8String("name");
+  Handle<Code> handler = CreateCodeOfKind(CodeKind::FOR_TESTING);
+
+  DisallowGarbageCollection no_gc;
+  // Many more live (map, name) pairs than entries thrash the initial tables.
+  for (const Handle<Map>& map : maps) stub_cache.Set(*name, *map, *handler);
+  CHECK_LT(0u, stub_cache.evictions());
+  CHECK_LT(0u, stub_cache.resizes());
+  CHECK_LT(StubCache::kPrimaryTableSize, stub_cache.primary_table_size());
+  CHECK_EQ(stub_cache.primary_table_size() /
+               (StubCache::kPrimaryTableSize / StubCache::kSecondaryTableSize),
+           stub_cache.secondary_table_size());
+  CHECK_EQ(maps.size(), stub_cache.updates());
+
+  // More entries are kept than the initial tables could hold.
+  int found = 0;
+  for (const Handle<Map>& map : maps) {
+    if (stub_cache.Get(*name, *map).ptr() == handler->ptr()) found++;
+  }
+  CHECK_LT(StubCache::kPrimaryTableSize + StubCache::kSecondaryTableSize,
+           found);
+
+  // Clearing keeps the size.
+  int size = stub_cache.primary_table_size();
+  stub_cache.Clear();
+  CHECK_EQ(size, stub_cache.primary_table_size());
+  CHECK_EQ(kNullAddress, stub_cache.Get(*name, *maps.back()).ptr());
+}
+
 #include "src/codegen/undef-code-stub-assembler-macros.inc"
 
 }  // namespace internal
@@ -346,3 +346,56 @@ TEST(InterruptAndTransitionSubjectFromTwoByteToOneByte) {
       Cast<i::IrRegExpData>(regexp->data(i_isolate));
   CHECK(data->has_latin1_bytecode());
 }
+
+namespace {
+
+Local<RegExp> CompileRegExp(const char* source) {
+  return CompileRun(source).As<RegExp>();
+}
+
+}  // namespace
+
+TEST(RegExpSet) {
+  LocalContext env;
+  Isolate* isolate = env->GetIsolate();
+  HandleScope handle_scope(isolate);
+
+  RegExpSet set(isolate);
+  CHECK(set.Add(CompileRegExp("/GET \\/api\\/v1\\/[a-z]+/")));
+  CHECK(set.Add(CompileRegExp("/(\\w+)=(\\d+);/")));
+  // Assertions and lookbehinds are not supported.
+  CHECK(!set.Add(CompileRegExp("/\\bfoo/")));
+  CHECK(!set.Add(CompileRegExp("/(?<=a)b/")));
+  // Neither are regexps the linear-time engine can't run.
+  CHECK(!set.Add(CompileRegExp("/(a)\\1/")));
+  CHECK(!set.Add(CompileRegExp("/foo/i")));
+  CHECK(set.Add(CompileRegExp("/[\\u0100-\\u0200]+z/")));
+  CHECK(set.Add(CompileRegExp("/ab/y")));
+  CHECK(set.Add(CompileRegExp("/x*/")));
+  CHECK_EQ(5, set.Size());
+
+  CHECK(set.Match(v8_str("")) == std::vector<int>({4}));
+  CHECK(set.Match(v8_str("GET /api/v1/user")) == std::vector<int>({0, 4}));
+  CHECK(set.Match(v8_str("a=b;c=12; GET /api/v2/user")) ==
+        std::vector<int>({1, 4}));
+  // U+0150 in UTF-8.
+  CHECK(set.Match(v8_str("ab\xC5\x90\xC5\x90z")) ==
+        std::vector<int>({2, 3, 4}));
+  CHECK(set.Match(v8_str("xab")) == std::vector<int>({4}));
+
+  // The DFA for a[ab]{13}x has more states than fit into the cache, so
+  // matching it against random input flushes the cache repeatedly.
+  RegExpSet large_set(isolate);
+  CHECK(large_set.Add(CompileRegExp("/a[ab]{13}x/")));
+  CHECK(large_set.Add(CompileRegExp("/(\\w+)=(\\d+);/")));
+  std::string subject;
+  uint32_t seed = 42;
+  for (int i = 0; i < 100000; i++) {
+    seed = seed * 1103515245 + 12345;
+    subject += (seed >> 16) & 1 ? 'a' : 'b';
+  }
+  CHECK(large_set.Match(v8_str((subject + "c=12;").c_str())) ==
+        std::vector<int>({1}));
+  CHECK(large_set.Match(v8_str((subject + "abbbbbbbbbbbbbx").c_str())) ==
+        std::vector<int>({0}));
+}
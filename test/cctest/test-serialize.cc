@@ -3078,6 +3078,220 @@ TEST(CodeSerializerAfterExecute) {
   v8_flags.always_turbofan = prev_always_turbofan_value;
 }
 
+TEST(CodeSerializerSkipOldBytecode) {
+  bool prev_always_turbofan_value = v8_flags.always_turbofan;
+  bool prev_skip_old_bytecode_value = v8_flags.code_cache_skip_old_bytecode;
+  bool prev_flush_bytecode_value = v8_flags.flush_bytecode;
+  bool prev_stress_flush_code_value = v8_flags.stress_flush_code;
+  v8_flags.always_turbofan = false;
+  v8_flags.code_cache_skip_old_bytecode = true;
+  v8_flags.flush_bytecode = true;
+  v8_flags.stress_flush_code = false;
+  const char* js_source =
+      "function f() { return 'abc'; }"
+      "function g() { return 'def'; }"
+      "function* h() { yield 'ghi'; }"
+      "f() + g() + h().next().value";
+
+  v8::ScriptCompiler::CachedData* cache;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate1 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate1);
+    v8::HandleScope scope(isolate1);
+    v8::Local<v8::Context> context = v8::Context::New(isolate1);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(v8_str(js_source), origin);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(isolate1, &source)
+            .ToLocalChecked();
+    CHECK(script->BindToCurrentContext()
+              ->Run(context)
+              .ToLocalChecked()
+              ->Equals(context, v8_str("abcdefghi"))
+              .FromJust());
+
+    // Make f and h look like they haven't run for a while. The GC never
+    // flushes resumable functions, so h must keep its bytecode.
+    DirectHandle<JSFunction> f = Cast<JSFunction>(v8::Utils::OpenDirectHandle(
+        *context->Global()->Get(context, v8_str("f")).ToLocalChecked()));
+    SharedFunctionInfo::EnsureOldForTesting(f->shared());
+    DirectHandle<JSFunction> h = Cast<JSFunction>(v8::Utils::OpenDirectHandle(
+        *context->Global()->Get(context, v8_str("h")).ToLocalChecked()));
+    SharedFunctionInfo::EnsureOldForTesting(h->shared());
+
+    cache = ScriptCompiler::CreateCodeCache(script);
+    // Serialization must leave the original function intact.
+    CHECK(f->shared()->HasBytecodeArray());
+  }
+  isolate1->Dispose();
+
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+    Isolate* i_isolate2 = reinterpret_cast<Isolate*>(isolate2);
+
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(v8_str(js_source), origin, cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+
+    // Only g and h should have been deserialized with bytecode.
+    DirectHandle<SharedFunctionInfo> toplevel =
+        v8::Utils::OpenDirectHandle(*script);
+    int compiled = 0;
+    int uncompiled = 0;
+    {
+      DisallowGarbageCollection no_gc;
+      SharedFunctionInfo::ScriptIterator iter(
+          i_isolate2, Cast<Script>(toplevel->script()));
+      for (Tagged<SharedFunctionInfo> info = iter.Next(); !info.is_null();
+           info = iter.Next()) {
+        if (info->is_toplevel()) continue;
+        if (info->is_compiled()) {
+          compiled++;
+        } else {
+          uncompiled++;
+        }
+      }
+    }
+    CHECK_EQ(2, compiled);
+    CHECK_EQ(1, uncompiled);
+
+    CHECK(script->BindToCurrentContext()
+              ->Run(context)
+              .ToLocalChecked()
+              ->Equals(context, v8_str("abcdefghi"))
+              .FromJust());
+  }
+  isolate2->Dispose();
+  delete cache;
+
+  v8_flags.always_turbofan = prev_always_turbofan_value;
+  v8_flags.code_cache_skip_old_bytecode = prev_skip_old_bytecode_value;
+  v8_flags.flush_bytecode = prev_flush_bytecode_value;
+  v8_flags.stress_flush_code = prev_stress_flush_code_value;
+}
+
+namespace {
+
+int CountCompiledInnerFunctions(v8::Isolate* isolate,
+                                v8::Local<v8::UnboundScript> script) {
+  Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate);
+  DisallowGarbageCollection no_gc;
+  SharedFunctionInfo::ScriptIterator iter(
+      i_isolate,
+      Cast<Script>(v8::Utils::OpenDirectHandle(*script)->script()));
+  int compiled = 0;
+  for (Tagged<SharedFunctionInfo> info = iter.Next(); !info.is_null();
+       info = iter.Next()) {
+    if (!info->is_toplevel() && info->is_compiled()) compiled++;
+  }
+  return compiled;
+}
+
+}  // namespace
+
+TEST(CodeSerializerDelta) {
+  bool prev_always_turbofan_value = v8_flags.always_turbofan;
+  v8_flags.always_turbofan = false;
+  const char* js_source =
+      "function f() { return 'abc'; }"
+      "function g() { return 'def'; }"
+      "f()";
+
+  v8::ScriptCompiler::CachedData* base_cache;
+  v8::ScriptCompiler::CachedData* delta_cache;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate1 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate1);
+    v8::HandleScope scope(isolate1);
+    v8::Local<v8::Context> context = v8::Context::New(isolate1);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(v8_str(js_source), origin);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate1, &source, v8::ScriptCompiler::kProduceCompileHints)
+            .ToLocalChecked();
+    script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    base_cache = ScriptCompiler::CreateCodeCache(script);
+
+    CompileRun("g()");
+    CHECK_EQ(2, CountCompiledInnerFunctions(isolate1, script));
+    delta_cache = ScriptCompiler::CreateCodeCacheDelta(script);
+    CHECK_NOT_NULL(delta_cache);
+    v8::ScriptCompiler::CachedData* full_cache =
+        ScriptCompiler::CreateCodeCache(script);
+    CHECK_LT(delta_cache->length, full_cache->length);
+    delete full_cache;
+  }
+  isolate1->Dispose();
+
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+    Isolate* i_isolate2 = reinterpret_cast<Isolate*>(isolate2);
+
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(v8_str(js_source), origin, base_cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!base_cache->rejected);
+    CHECK_EQ(1, CountCompiledInnerFunctions(isolate2, script));
+
+    // A delta for a different source of the same length is rejected.
+    const char* other_source =
+        "function f() { return 'abc'; }"
+        "function g() { return 'xyz'; }"
+        "f()";
+    CHECK_EQ(strlen(js_source), strlen(other_source));
+    v8::ScriptCompiler::Source other(v8_str(other_source), origin);
+    v8::Local<v8::UnboundScript> other_script =
+        v8::ScriptCompiler::CompileUnboundScript(isolate2, &other)
+            .ToLocalChecked();
+    CHECK(!ScriptCompiler::MergeCodeCacheDelta(isolate2, other_script,
+                                               delta_cache));
+    CHECK(delta_cache->rejected);
+    CHECK_EQ(0, CountCompiledInnerFunctions(isolate2, other_script));
+
+    CHECK(ScriptCompiler::MergeCodeCacheDelta(isolate2, script, delta_cache));
+    CHECK(!delta_cache->rejected);
+    CHECK_EQ(2, CountCompiledInnerFunctions(isolate2, script));
+
+    DisallowCompilation no_compile_expected(i_isolate2);
+    script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    v8::Local<v8::Function> g = v8::Local<v8::Function>::Cast(
+        context->Global()->Get(context, v8_str("g")).ToLocalChecked());
+    CHECK(g->Call(context, context->Global(), 0, nullptr)
+              .ToLocalChecked()
+              ->Equals(context, v8_str("def"))
+              .FromJust());
+  }
+  isolate2->Dispose();
+  delete base_cache;
+  delete delta_cache;
+
+  v8_flags.always_turbofan = prev_always_turbofan_value;
+}
+
 TEST(CodeSerializerFlagChange) {
   const char* js_source = "function f() { return 'abc'; }; f() + 'def'";
   v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(js_source);
@@ -755,6 +755,67 @@ STREAM_TEST(TestErrorInCodeSectionDetectedByCompiler) {
   CHECK(tester.IsPromiseRejected());
 }
 
+// Test an error in the code section, found by background validation of
+// lazily compiled functions. Once the error is found, the stream fails without
+// decoding the remaining functions.
+STREAM_TEST(TestErrorInCodeSectionDetectedByLazyValidation) {
+  i::FlagScope<bool> lazy_compilation(&i::v8_flags.wasm_lazy_compilation,
+                                      true);
+  i::FlagScope<bool> no_lazy_validation(&i::v8_flags.wasm_lazy_validation,
+                                        false);
+  StreamTester tester(isolate);
+
+  uint8_t code[] = {
+      U32V_1(4),                  // body size
+      U32V_1(0),                  // locals count
+      kExprLocalGet, 0, kExprEnd  // body
+  };
+
+  uint8_t invalid_code[] = {
+      U32V_1(4),                  // body size
+      U32V_1(0),                  // locals count
+      kExprI64Const, 0, kExprEnd  // body
+  };
+
+  // Background validation starts after 16 functions were received.
+  constexpr uint8_t kNumFunctions = 20;
+  constexpr uint8_t kInvalidFunction = 3;
+  std::vector<uint8_t> bytes = {
+      WASM_MODULE_HEADER,                 // module header
+      kTypeSectionCode,                   // section code
+      U32V_1(1 + SIZEOF_SIG_ENTRY_x_x),   // section size
+      U32V_1(1),                          // type count
+      SIG_ENTRY_x_x(kI32Code, kI32Code),  // signature entry
+      kFunctionSectionCode,               // section code
+      U32V_1(1 + kNumFunctions),          // section size
+      U32V_1(kNumFunctions),              // functions count
+  };
+  bytes.insert(bytes.end(), kNumFunctions, 0);  // signature indexes
+  bytes.insert(bytes.end(),
+               {
+                   kCodeSectionCode,                             // section code
+                   U32V_1(1 + arraysize(code) * kNumFunctions),  // section size
+                   U32V_1(kNumFunctions),  // functions count
+               });
+
+  tester.OnBytesReceived(bytes.data(), bytes.size());
+  for (uint8_t i = 0; i < kNumFunctions; ++i) {
+    if (i == kInvalidFunction) {
+      tester.OnBytesReceived(invalid_code, arraysize(invalid_code));
+    } else {
+      tester.OnBytesReceived(code, arraysize(code));
+    }
+    tester.RunCompilerTasks();
+    CHECK(tester.IsPromisePending());
+  }
+  tester.FinishStream();
+  tester.RunCompilerTasks();
+
+  CHECK(tester.IsPromiseRejected());
+  CHECK_NE(std::string::npos,
+           tester.error_message().find("Compiling function #3 failed"));
+}
+
 // Test Abort before any bytes arrive.
 STREAM_TEST(TestAbortImmediately) {
   StreamTester tester(isolate);
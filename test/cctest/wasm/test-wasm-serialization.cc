@@ -111,6 +111,9 @@ class WasmSerializationTest {
   }
 
   v8::MemorySpan<const uint8_t> wire_bytes() const { return wire_bytes_; }
+  v8::MemorySpan<const uint8_t> serialized_bytes() const {
+    return serialized_bytes_;
+  }
 
   CompileTimeImports MakeCompileTimeImports() { return CompileTimeImports{}; }
 
@@ -233,6 +236,63 @@ TEST(DeserializeWithSourceUrl) {
   test.CollectGarbage();
 }
 
+TEST(DeserializeLazily) {
+  FlagScope<bool> lazy_deserialization(&v8_flags.wasm_lazy_deserialization,
+                                       true);
+  WasmSerializationTest test;
+  {
+    HandleScope scope(CcTest::i_isolate());
+    Handle<WasmModuleObject> module_object;
+    CHECK(test.Deserialize().ToHandle(&module_object));
+    NativeModule* native_module = module_object->native_module();
+    CHECK_NOT_NULL(native_module->lazily_deserialized_code());
+
+    // The TurboFan code of the exported function stays serialized until the
+    // function gets called. Its record is released then.
+    constexpr int kExportedFunction = 2;
+    const int declared_index =
+        declared_function_index(native_module->module(), kExportedFunction);
+    CHECK(!native_module->HasCode(kExportedFunction));
+    CHECK_NOT_NULL(
+        native_module->lazily_deserialized_code()->GetRecord(declared_index));
+    test.DeserializeAndRun();
+    CHECK(native_module->HasCodeWithTier(kExportedFunction,
+                                         ExecutionTier::kTurbofan));
+    CHECK_NULL(
+        native_module->lazily_deserialized_code()->GetRecord(declared_index));
+
+    // Later first calls, e.g. from other threads, get the published code.
+    WasmCodeRefScope code_ref_scope;
+    bool deserialized;
+    CHECK_EQ(native_module->GetCode(kExportedFunction),
+             native_module->lazily_deserialized_code()->DeserializeFunction(
+                 native_module, kExportedFunction, &deserialized));
+    CHECK(!deserialized);
+  }
+  test.CollectGarbage();
+}
+
+TEST(SerializeLazilyDeserializedModule) {
+  FlagScope<bool> lazy_deserialization(&v8_flags.wasm_lazy_deserialization,
+                                       true);
+  WasmSerializationTest test;
+  {
+    HandleScope scope(CcTest::i_isolate());
+    Handle<WasmModuleObject> module_object;
+    CHECK(test.Deserialize().ToHandle(&module_object));
+
+    // Nothing ran, so serializing again copies the records that were not
+    // deserialized yet and reproduces the original data.
+    WasmSerializer serializer(module_object->native_module());
+    size_t size = serializer.GetSerializedNativeModuleSize();
+    CHECK_EQ(test.serialized_bytes().size(), size);
+    std::unique_ptr<uint8_t[]> buffer(new uint8_t[size]);
+    CHECK(serializer.SerializeNativeModule({buffer.get(), size}));
+    CHECK_EQ(0, memcmp(buffer.get(), test.serialized_bytes().data(), size));
+  }
+  test.CollectGarbage();
+}
+
 TEST(DeserializeMismatchingVersion) {
   WasmSerializationTest test;
   {
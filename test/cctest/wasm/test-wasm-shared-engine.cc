@@ -13,6 +13,7 @@
 #include "src/wasm/wasm-objects-inl.h"
 
 #include "test/cctest/cctest.h"
+#include "test/common/flag-utils.h"
 #include "test/common/wasm/test-signatures.h"
 #include "test/common/wasm/wasm-macro-gen.h"
 #include "test/common/wasm/wasm-module-runner.h"
@@ -207,6 +208,41 @@ TEST(SharedEngineRunImported) {
   }
 }
 
+TEST(SharedEngineImportedInstanceCompilesExportWrappers) {
+  // Force specific JS-to-Wasm wrappers, which are compiled per isolate.
+  FlagScope<bool> no_generic_wrapper(&v8_flags.wasm_generic_wrapper, false);
+  SharedModule module;
+  {
+    SharedEngineIsolate isolate;
+    HandleScope scope(isolate.isolate());
+    ZoneBuffer* buffer = BuildReturnConstantModule(isolate.zone(), 23);
+    Handle<WasmInstanceObject> instance = isolate.CompileAndInstantiate(buffer);
+    module = isolate.ExportInstance(instance);
+    CHECK_EQ(23, isolate.Run(instance));
+  }
+  {
+    SharedEngineIsolate isolate;
+    HandleScope scope(isolate.isolate());
+    const WasmModule* wasm_module = module->module();
+    uint32_t sig_index = wasm_module->functions[0].sig_index;
+    uint32_t canonical_sig_index =
+        wasm_module->isorecursive_canonical_type_ids[sig_index];
+    Heap* heap = isolate.isolate()->heap();
+    // Importing alone does not compile any wrappers.
+    GetWasmEngine()->ImportNativeModule(isolate.isolate(), module, {});
+    heap->EnsureWasmCanonicalRttsSize(canonical_sig_index + 1);
+    Tagged<MaybeObject> entry =
+        heap->js_to_wasm_wrappers()->Get(canonical_sig_index);
+    CHECK(entry.IsCleared() || IsUndefined(entry.GetHeapObject()));
+    // The wrapper for the exported function is compiled on instantiation.
+    Handle<WasmInstanceObject> instance = isolate.ImportInstance(module);
+    entry = heap->js_to_wasm_wrappers()->Get(canonical_sig_index);
+    CHECK(entry.IsStrongOrWeak());
+    CHECK(IsCodeWrapper(entry.GetHeapObject()));
+    CHECK_EQ(23, isolate.Run(instance));
+  }
+}
+
 TEST(SharedEngineRunThreadedBuildingSync) {
   SharedEngineThread thread1([](SharedEngineIsolate* isolate) {
     HandleScope scope(isolate->isolate());
@@ -0,0 +1,107 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Workloads on objects whose properties are in dictionary mode, i.e. backed
+// by a NameDictionary or a SwissNameDictionary, depending on the build. They
+// compare the two backing stores on objects used as hash maps.
+
+const kKeyCount = 1000;
+const kKeys = [];
+const kMissingKeys = [];
+for (let i = 0; i < kKeyCount; i++) {
+  kKeys.push("key" + i);
+  kMissingKeys.push("missing" + i);
+}
+
+// Switch the object's properties to dictionary mode.
+function MakeDictionaryMode(obj) {
+  obj.foo = 0;
+  obj.bar = 0;
+  // Delete the second-to-last property first to force normalization.
+  delete obj.foo;
+  delete obj.bar;
+  return obj;
+}
+
+function NewDictionary(count) {
+  const obj = MakeDictionaryMode({});
+  for (let i = 0; i < count; i++) obj[kKeys[i]] = i;
+  return obj;
+}
+
+let result;
+let object;
+
+function Add() {
+  const obj = MakeDictionaryMode({});
+  for (let i = 0; i < kKeyCount; i++) obj[kKeys[i]] = i;
+  result = obj;
+}
+
+function AddDelete() {
+  const obj = MakeDictionaryMode({});
+  for (let i = 0; i < kKeyCount; i++) obj[kKeys[i]] = i;
+  for (let i = 0; i < kKeyCount; i++) delete obj[kKeys[i]];
+  result = obj;
+}
+
+function SetupObject() {
+  object = NewDictionary(kKeyCount);
+}
+
+function Lookup() {
+  let sum = 0;
+  for (let i = 0; i < kKeyCount; i++) sum += object[kKeys[i]];
+  result = sum;
+}
+
+function LookupMissing() {
+  let count = 0;
+  for (let i = 0; i < kKeyCount; i++) {
+    if (kMissingKeys[i] in object) count++;
+  }
+  result = count;
+}
+
+function Store() {
+  for (let i = 0; i < kKeyCount; i++) object[kKeys[i]] = i + 1;
+  result = object;
+}
+
+// Deletes and re-adds a sliding window of properties, which leaves deleted
+// entries behind for lookups to skip.
+function Churn() {
+  for (let i = 0; i < kKeyCount; i++) {
+    delete object[kKeys[i]];
+    object[kKeys[(i + kKeyCount / 2) % kKeyCount]] = i;
+  }
+  let sum = 0;
+  for (let i = 0; i < kKeyCount; i++) sum += object[kKeys[i]] | 0;
+  result = sum;
+}
+
+function ForIn() {
+  let count = 0;
+  for (const key in object) count++;
+  result = count;
+}
+
+function TearDown() {
+  object = undefined;
+  result = undefined;
+}
+
+function CreateBenchmark(name, run, setup = SetupObject) {
+  return new BenchmarkSuite(name, [1000], [
+    new Benchmark(name, false, false, 0, run, setup, TearDown),
+  ]);
+}
+
+CreateBenchmark("Add", Add, () => {});
+CreateBenchmark("AddDelete", AddDelete, () => {});
+CreateBenchmark("Lookup", Lookup);
+CreateBenchmark("LookupMissing", LookupMissing);
+CreateBenchmark("Store", Store);
+CreateBenchmark("Churn", Churn);
+CreateBenchmark("ForIn", ForIn);
@@ -0,0 +1,186 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+/**
+ * Test compile time and code quality of Liftoff for functions with loops
+ * that keep several locals live across iterations. Run with --liftoff-only.
+ * The different suites measure the following:
+ * Compile:   Eagerly compiles a module with many such functions. Run with
+ *            --no-wasm-lazy-compilation to include compilation in the score.
+ * IntLoop:   Executes a loop updating i32 locals.
+ * FloatLoop: Executes a loop updating f64 and i32 locals.
+ *
+ * Note: The wasm module builder is not available for performance tests, so
+ * the module is assembled by the minimal encoder below.
+ */
+(function() {
+  const kWasmI32 = 0x7f;
+  const kWasmF64 = 0x7c;
+  const kWasmVoid = 0x40;
+
+  const kExprLoop = 0x03;
+  const kExprEnd = 0x0b;
+  const kExprBrIf = 0x0d;
+  const kExprLocalGet = 0x20;
+  const kExprLocalSet = 0x21;
+  const kExprLocalTee = 0x22;
+  const kExprI32Const = 0x41;
+  const kExprI32LtS = 0x48;
+  const kExprI32Add = 0x6a;
+  const kExprI32Mul = 0x6c;
+  const kExprI32And = 0x71;
+  const kExprI32Xor = 0x73;
+  const kExprI32Shl = 0x74;
+  const kExprI32ShrU = 0x76;
+  const kExprF64Add = 0xa0;
+  const kExprF64Mul = 0xa2;
+  const kExprF64SConvertI32 = 0xb7;
+
+  // (i32) -> i32. Locals: 0 = n, 1 = i, 2 = a, 3 = b, 4 = c.
+  const kIntLoopBody = [
+    1, 4, kWasmI32,
+    // a = n; b = n * 7; c = n + 13;
+    kExprLocalGet, 0, kExprLocalSet, 2,
+    kExprLocalGet, 0, kExprI32Const, 7, kExprI32Mul, kExprLocalSet, 3,
+    kExprLocalGet, 0, kExprI32Const, 13, kExprI32Add, kExprLocalSet, 4,
+    kExprLoop, kWasmVoid,
+      // a = a + i;
+      kExprLocalGet, 2, kExprLocalGet, 1, kExprI32Add, kExprLocalSet, 2,
+      // b = b ^ (a << 3);
+      kExprLocalGet, 3, kExprLocalGet, 2, kExprI32Const, 3, kExprI32Shl,
+      kExprI32Xor, kExprLocalSet, 3,
+      // c = c + (b >>> 5);
+      kExprLocalGet, 4, kExprLocalGet, 3, kExprI32Const, 5, kExprI32ShrU,
+      kExprI32Add, kExprLocalSet, 4,
+      // a = a ^ c;
+      kExprLocalGet, 2, kExprLocalGet, 4, kExprI32Xor, kExprLocalSet, 2,
+      // if (++i < n) continue;
+      kExprLocalGet, 1, kExprI32Const, 1, kExprI32Add, kExprLocalTee, 1,
+      kExprLocalGet, 0, kExprI32LtS, kExprBrIf, 0,
+    kExprEnd,
+    // return (a ^ b) + c;
+    kExprLocalGet, 2, kExprLocalGet, 3, kExprI32Xor, kExprLocalGet, 4,
+    kExprI32Add,
+    kExprEnd
+  ];
+
+  // (i32) -> f64. Locals: 0 = n, 1 = i, 2 = x, 3 = y.
+  const kFloatLoopBody = [
+    2, 1, kWasmI32, 2, kWasmF64,
+    // x = n;
+    kExprLocalGet, 0, kExprF64SConvertI32, kExprLocalSet, 2,
+    kExprLoop, kWasmVoid,
+      // x = x + i;
+      kExprLocalGet, 2, kExprLocalGet, 1, kExprF64SConvertI32, kExprF64Add,
+      kExprLocalSet, 2,
+      // y = y + x * (i & 7);
+      kExprLocalGet, 3, kExprLocalGet, 2, kExprLocalGet, 1, kExprI32Const, 7,
+      kExprI32And, kExprF64SConvertI32, kExprF64Mul, kExprF64Add,
+      kExprLocalSet, 3,
+      // if (++i < n) continue;
+      kExprLocalGet, 1, kExprI32Const, 1, kExprI32Add, kExprLocalTee, 1,
+      kExprLocalGet, 0, kExprI32LtS, kExprBrIf, 0,
+    kExprEnd,
+    // return x + y;
+    kExprLocalGet, 2, kExprLocalGet, 3, kExprF64Add,
+    kExprEnd
+  ];
+
+  function leb(value) {
+    const bytes = [];
+    do {
+      let byte = value & 0x7f;
+      value >>>= 7;
+      if (value != 0) byte |= 0x80;
+      bytes.push(byte);
+    } while (value != 0);
+    return bytes;
+  }
+
+  function vector(entries) {
+    return [...leb(entries.length), ...entries.flat()];
+  }
+
+  function section(id, entries) {
+    const contents = vector(entries);
+    return [id, ...leb(contents.length), ...contents];
+  }
+
+  function name(str) {
+    return vector([...str].map(c => c.charCodeAt(0)));
+  }
+
+  // Builds a module with {copies} pairs of the functions above, exporting the
+  // first pair. A trailing custom section holds a 32-bit id, which the Compile
+  // suite changes to prevent hits in the native module cache.
+  function buildModule(copies) {
+    const functions = [];
+    const bodies = [];
+    for (let i = 0; i < copies; ++i) {
+      functions.push([0], [1]);
+      bodies.push([...leb(kIntLoopBody.length), ...kIntLoopBody],
+                  [...leb(kFloatLoopBody.length), ...kFloatLoopBody]);
+    }
+    const id = [...name('id'), 0, 0, 0, 0];
+    return new Uint8Array([
+      0, 97, 115, 109, 1, 0, 0, 0,
+      ...section(1, [[0x60, 1, kWasmI32, 1, kWasmI32],
+                     [0x60, 1, kWasmI32, 1, kWasmF64]]),
+      ...section(3, functions),
+      ...section(7, [[...name('intLoop'), 0, 0], [...name('floatLoop'), 0, 1]]),
+      ...section(10, bodies),
+      0, ...leb(id.length), ...id
+    ]);
+  }
+
+  const kIterations = 10_000;
+
+  function intLoop(n) {
+    let i = 0, a = n, b = Math.imul(n, 7), c = n + 13;
+    do {
+      a = (a + i) | 0;
+      b = b ^ (a << 3);
+      c = (c + (b >>> 5)) | 0;
+      a = a ^ c;
+      i++;
+    } while (i < n);
+    return ((a ^ b) + c) | 0;
+  }
+
+  function floatLoop(n) {
+    let i = 0, x = n, y = 0;
+    do {
+      x = x + i;
+      y = y + x * (i & 7);
+      i++;
+    } while (i < n);
+    return x + y;
+  }
+
+  const wasm = new WebAssembly.Instance(
+      new WebAssembly.Module(buildModule(1)), {}).exports;
+  const expectedInt = intLoop(kIterations);
+  const expectedFloat = floatLoop(kIterations);
+
+  const compileBytes = buildModule(200);
+  const idView = new DataView(compileBytes.buffer, compileBytes.length - 4);
+  let moduleId = 0;
+
+  let benchmarks = [
+    function Compile() {
+      idView.setUint32(0, ++moduleId, true);
+      new WebAssembly.Module(compileBytes);
+    },
+    function IntLoop() {
+      assertEquals(expectedInt, wasm.intLoop(kIterations));
+    },
+    function FloatLoop() {
+      assertEquals(expectedFloat, wasm.floatLoop(kIterations));
+    }
+  ];
+
+  for (let fct of benchmarks) {
+    createSuite(fct.name, 100, fct);
+  }
+})();
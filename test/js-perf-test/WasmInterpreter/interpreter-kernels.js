@@ -0,0 +1,185 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+/**
+ * Test throughput of the Wasm interpreter (DrumBrake) for bulk-memory and
+ * SIMD kernels. Run with --wasm-jitless.
+ * The different suites measure the following:
+ * MemCopy:  memory.copy of a 16KB block.
+ * MemFill:  memory.fill of a 16KB block.
+ * SimdCopy: A loop copying a 16KB block with s128.load and s128.store.
+ * SimdAdd:  A loop adding two 16KB blocks of i32x4 lanes.
+ *
+ * Note: The wasm module builder is not available for performance tests, so
+ * the module is assembled by the minimal encoder below.
+ */
+(function() {
+  const kWasmI32 = 0x7f;
+  const kWasmVoid = 0x40;
+
+  const kExprBlock = 0x02;
+  const kExprLoop = 0x03;
+  const kExprEnd = 0x0b;
+  const kExprBr = 0x0c;
+  const kExprBrIf = 0x0d;
+  const kExprLocalGet = 0x20;
+  const kExprLocalSet = 0x21;
+  const kExprI32Const = 0x41;
+  const kExprI32GeU = 0x4f;
+  const kExprI32Add = 0x6a;
+  const kNumericPrefix = 0xfc;
+  const kExprMemoryCopy = 0x0a;
+  const kExprMemoryFill = 0x0b;
+  const kSimdPrefix = 0xfd;
+  const kExprS128LoadMem = 0x00;
+  const kExprS128StoreMem = 0x0b;
+  const kExprI32x4Add = [0xae, 0x01];
+
+  const kSize = 16 * 1024;
+  const kSrc = 0;
+  const kSrc2 = kSize;
+  const kDst = 2 * kSize;
+  const kFillValue = 0x5a;
+
+  function leb(value) {
+    const bytes = [];
+    do {
+      let byte = value & 0x7f;
+      value >>>= 7;
+      if (value != 0) byte |= 0x80;
+      bytes.push(byte);
+    } while (value != 0);
+    return bytes;
+  }
+
+  function sleb(value) {
+    const bytes = [];
+    while (true) {
+      const byte = value & 0x7f;
+      value >>= 7;
+      if ((value == 0 && (byte & 0x40) == 0) ||
+          (value == -1 && (byte & 0x40) != 0)) {
+        bytes.push(byte);
+        return bytes;
+      }
+      bytes.push(byte | 0x80);
+    }
+  }
+
+  function vector(entries) {
+    return [...leb(entries.length), ...entries.flat()];
+  }
+
+  function section(id, entries) {
+    const contents = vector(entries);
+    return [id, ...leb(contents.length), ...contents];
+  }
+
+  function name(str) {
+    return vector([...str].map(c => c.charCodeAt(0)));
+  }
+
+  function memarg(offset) {
+    return [4, ...leb(offset)];
+  }
+
+  // All functions are (i32 n) -> void.
+  const kMemCopyBody = [
+    0,
+    kExprI32Const, ...sleb(kDst), kExprI32Const, ...sleb(kSrc),
+    kExprLocalGet, 0,
+    kNumericPrefix, kExprMemoryCopy, 0, 0,
+    kExprEnd
+  ];
+
+  const kMemFillBody = [
+    0,
+    kExprI32Const, ...sleb(kDst), kExprI32Const, ...sleb(kFillValue),
+    kExprLocalGet, 0,
+    kNumericPrefix, kExprMemoryFill, 0,
+    kExprEnd
+  ];
+
+  // Wraps {body} in a loop over local 1 = i from 0 to n in steps of 16.
+  function simdLoop(body) {
+    return [
+      1, 1, kWasmI32,
+      kExprBlock, kWasmVoid,
+        kExprLoop, kWasmVoid,
+          kExprLocalGet, 1, kExprLocalGet, 0, kExprI32GeU, kExprBrIf, 1,
+          ...body,
+          kExprLocalGet, 1, kExprI32Const, 16, kExprI32Add, kExprLocalSet, 1,
+          kExprBr, 0,
+        kExprEnd,
+      kExprEnd,
+      kExprEnd
+    ];
+  }
+
+  // dst[i] = src[i];
+  const kSimdCopyBody = simdLoop([
+    kExprLocalGet, 1,
+    kExprLocalGet, 1, kSimdPrefix, kExprS128LoadMem, ...memarg(kSrc),
+    kSimdPrefix, kExprS128StoreMem, ...memarg(kDst)
+  ]);
+
+  // dst[i] = src[i] + src2[i];
+  const kSimdAddBody = simdLoop([
+    kExprLocalGet, 1,
+    kExprLocalGet, 1, kSimdPrefix, kExprS128LoadMem, ...memarg(kSrc),
+    kExprLocalGet, 1, kSimdPrefix, kExprS128LoadMem, ...memarg(kSrc2),
+    kSimdPrefix, ...kExprI32x4Add,
+    kSimdPrefix, kExprS128StoreMem, ...memarg(kDst)
+  ]);
+
+  function buildModule() {
+    const bodies = [kMemCopyBody, kMemFillBody, kSimdCopyBody, kSimdAddBody];
+    return new Uint8Array([
+      0, 97, 115, 109, 1, 0, 0, 0,
+      ...section(1, [[0x60, 1, kWasmI32, 0]]),
+      ...section(3, bodies.map(() => [0])),
+      ...section(5, [[0, 1]]),
+      ...section(7, [
+        [...name('memory'), 2, 0],
+        [...name('memCopy'), 0, 0],
+        [...name('memFill'), 0, 1],
+        [...name('simdCopy'), 0, 2],
+        [...name('simdAdd'), 0, 3]
+      ]),
+      ...section(10, bodies.map(body => [...leb(body.length), ...body]))
+    ]);
+  }
+
+  const wasm = new WebAssembly.Instance(
+      new WebAssembly.Module(buildModule()), {}).exports;
+  const bytes = new Uint8Array(wasm.memory.buffer);
+  const words = new Int32Array(wasm.memory.buffer);
+  for (let i = 0; i < 2 * kSize; ++i) bytes[i] = (i * 7) & 0xff;
+  const kLast = kSize / 4 - 1;
+  const expectedSum =
+      (words[kSrc / 4 + kLast] + words[kSrc2 / 4 + kLast]) | 0;
+
+  let benchmarks = [
+    function MemCopy() {
+      wasm.memCopy(kSize);
+      assertEquals(bytes[kSrc + kSize - 1], bytes[kDst + kSize - 1]);
+    },
+    function MemFill() {
+      wasm.memFill(kSize);
+      assertEquals(kFillValue, bytes[kDst + kSize - 1]);
+    },
+    function SimdCopy() {
+      wasm.simdCopy(kSize);
+      assertEquals(bytes[kSrc + kSize - 1], bytes[kDst + kSize - 1]);
+    },
+    function SimdAdd() {
+      wasm.simdAdd(kSize);
+      assertEquals(expectedSum, words[kDst / 4 + kLast]);
+    }
+  ];
+
+  for (let fct of benchmarks) {
+    createSuite(fct.name, 100, fct);
+  }
+})();
@@ -89,6 +89,30 @@ d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
   });
 })();
 
+// Tests that Math functions are recognized if their signature matches.
+(function TestRecognizedMathFunctions() {
+  console.log("Testing Math functions");
+  let builder = new WasmModuleBuilder();
+  builder.addImport("m", "sqrt", kSig_d_d);
+  builder.addImport("m", "sqrt_f32", kSig_f_f);
+  builder.addImport("m", "pow", kSig_d_dd);
+  builder.addImport("m", "fround", kSig_f_d);
+  // Not recognized: there is no f32 instruction for Math.sin.
+  builder.addImport("m", "sin_f32", kSig_f_f);
+  // Not recognized: signature does not match.
+  builder.addImport("m", "min_i32", kSig_i_ii);
+  builder.instantiate({
+    m: {
+      sqrt: Math.sqrt,
+      sqrt_f32: Math.sqrt,
+      pow: Math.pow,
+      fround: Math.fround,
+      sin_f32: Math.sin,
+      min_i32: Math.min,
+    }
+  });
+})();
+
 // Tests imported strings.
 (function TestImportedStrings() {
   console.log("Testing imported strings");
@@ -0,0 +1,104 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --expose-gc
+
+// Property accesses on dictionary-mode objects remember where they found a
+// name in the property dictionary. Check that mutations of the dictionary
+// don't make them find stale entries.
+
+function MakeDictionary(n) {
+  const o = {};
+  for (let i = 0; i < n; i++) o["k" + i] = i;
+  delete o.k0;
+  assertFalse(%HasFastProperties(o));
+  return o;
+}
+
+function Get(o, key) { return o[key]; }
+function Set(o, key, value) { o[key] = value; }
+
+const keys = [];
+for (let i = 1; i < 64; i++) keys.push("k" + i);
+
+(function TestLoadAndStore() {
+  const o = MakeDictionary(64);
+  for (let round = 0; round < 3; round++) {
+    for (const key of keys) Set(o, key, key + round);
+    for (const key of keys) assertEquals(key + round, Get(o, key));
+  }
+})();
+
+(function TestDeleteAndReAdd() {
+  const o = MakeDictionary(64);
+  for (const key of keys) Get(o, key);
+  for (let i = 1; i < 64; i += 2) delete o["k" + i];
+  for (let i = 1; i < 64; i++) {
+    assertEquals(i % 2 ? undefined : i, Get(o, "k" + i));
+  }
+  // Re-added properties may end up in other entries.
+  for (let i = 63; i > 0; i -= 2) Set(o, "k" + i, -i);
+  for (let i = 1; i < 64; i++) {
+    assertEquals(i % 2 ? -i : i, Get(o, "k" + i));
+  }
+})();
+
+(function TestGrowAndShrink() {
+  const o = MakeDictionary(16);
+  for (let i = 1; i < 16; i++) Get(o, "k" + i);
+  // Growing moves the properties to a new dictionary.
+  for (let i = 16; i < 1024; i++) Set(o, "k" + i, i);
+  for (let i = 1; i < 1024; i++) assertEquals(i, Get(o, "k" + i));
+  // Deleting most of them shrinks it again.
+  for (let i = 32; i < 1024; i++) delete o["k" + i];
+  for (let i = 1; i < 1024; i++) {
+    assertEquals(i < 32 ? i : undefined, Get(o, "k" + i));
+  }
+})();
+
+(function TestValuesThatAreNames() {
+  // A value slot holding a name must not be mistaken for its key slot.
+  const o = MakeDictionary(8);
+  for (let i = 1; i < 8; i++) Set(o, "k" + i, "k" + ((i % 7) + 1));
+  for (let i = 1; i < 8; i++) {
+    assertEquals("k" + ((i % 7) + 1), Get(o, "k" + i));
+  }
+  delete o.k3;
+  assertEquals(undefined, Get(o, "k3"));
+  Set(o, "k3", "again");
+  assertEquals("again", Get(o, "k3"));
+})();
+
+(function TestManyObjects() {
+  // The same names in different dictionaries, some of which die.
+  const objects = [];
+  for (let i = 0; i < 100; i++) {
+    const o = MakeDictionary(8);
+    o.k1 = i;
+    objects.push(o);
+  }
+  for (let i = 0; i < 100; i++) assertEquals(i, Get(objects[i], "k1"));
+  objects.length = 50;
+  gc();
+  for (let i = 0; i < 50; i++) {
+    const o = MakeDictionary(8);
+    o.k2 = -i;
+    objects.push(o);
+  }
+  for (let i = 0; i < 50; i++) assertEquals(i, Get(objects[i], "k1"));
+  for (let i = 50; i < 100; i++) assertEquals(50 - i, Get(objects[i], "k2"));
+})();
+
+(function TestPrototypeChain() {
+  // Names missing from the receiver's dictionary are looked up on the
+  // prototype.
+  const proto = MakeDictionary(8);
+  const o = MakeDictionary(4);
+  Object.setPrototypeOf(o, proto);
+  o.k1 = "own";
+  assertEquals("own", Get(o, "k1"));
+  assertEquals(5, Get(o, "k5"));
+  delete o.k1;
+  assertEquals(1, Get(o, "k1"));
+})();
@@ -0,0 +1,57 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// String keys are found whether or not they are internalized or have their
+// hash computed, and share bucket chains with other strings.
+
+function Flat(s) {
+  // Builds a non-internalized copy of {s} without a computed hash.
+  return s.split("").join("");
+}
+
+(function TestMap() {
+  const map = new Map();
+  for (let i = 0; i < 1000; i++) map.set("key" + i, i);
+  for (let i = 0; i < 1000; i++) {
+    assertEquals(i, map.get(Flat("key" + i)));
+    assertTrue(map.has("ke" + "y" + i));
+    assertFalse(map.has(Flat("yek" + i)));
+  }
+  for (let i = 0; i < 1000; i += 2) assertTrue(map.delete(Flat("key" + i)));
+  for (let i = 0; i < 1000; i++) {
+    assertEquals(i % 2 ? i : undefined, map.get("key" + i));
+  }
+  assertEquals(500, map.size);
+})();
+
+(function TestSet() {
+  const set = new Set();
+  for (let i = 0; i < 1000; i++) set.add(Flat("value" + i));
+  for (let i = 0; i < 1000; i++) set.add("value" + i);
+  assertEquals(1000, set.size);
+  for (let i = 0; i < 1000; i++) assertTrue(set.has(Flat("value" + i)));
+  assertFalse(set.has("value1000"));
+})();
+
+(function TestIndexLikeStrings() {
+  // Strings that look like array indices keep the index in their hash field.
+  const map = new Map();
+  for (let i = 0; i < 100; i++) map.set(String(i), i);
+  for (let i = 0; i < 100; i++) {
+    assertEquals(i, map.get(Flat(String(i))));
+    assertFalse(map.has(i));
+  }
+})();
+
+(function TestOptimized() {
+  function Get(map, key) { return map.get(key); }
+  %PrepareFunctionForOptimization(Get);
+  const map = new Map([["a", 1], ["b", 2], [Flat("abc"), 3]]);
+  assertEquals(3, Get(map, "abc"));
+  %OptimizeFunctionOnNextCall(Get);
+  assertEquals(3, Get(map, Flat("abc")));
+  assertEquals(undefined, Get(map, "abd"));
+})();
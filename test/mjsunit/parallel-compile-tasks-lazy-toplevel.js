@@ -0,0 +1,38 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --parallel-compile-tasks-for-lazy-toplevel
+// Flags: --parallel-compile-tasks-min-function-size=32
+
+var outer_var = 42;
+
+// Small enough to stay on the main thread.
+function small() { return outer_var; }
+
+function large_outer(a) {
+  function inner(b) {
+    return a + b + outer_var;
+  }
+  var sum = 0;
+  for (var i = 0; i < 10; i++) sum += inner(i);
+  return sum;
+}
+
+var large_expression = function(x) {
+  var result = [];
+  for (var i = 0; i < x; i++) result.push(i * outer_var);
+  return result.length;
+};
+
+assertEquals(42, small());
+assertEquals(465, large_outer(0));
+assertEquals(5, large_expression(5));
+
+var gen = (function*() {
+  yield 1;
+  yield 2;
+});
+var it = gen();
+assertEquals(1, it.next().value);
+assertEquals(2, it.next().value);
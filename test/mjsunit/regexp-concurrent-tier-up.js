@@ -0,0 +1,40 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-tier-up --regexp-tier-up-ticks=1
+// Flags: --regexp-concurrent-tier-up --allow-natives-syntax
+// Flags: --no-force-slow-path --no-regexp-interpret-all
+// Flags: --no-enable-experimental-regexp-engine
+
+// Regexps keep matching in the interpreter while their tier-up to native code
+// is compiled in the background, and switch to native code once it is done.
+
+const kLatin1 = true;
+const kUnicode = false;
+
+function TierUpWhileMatching(re, subject, expected, is_latin1) {
+  for (let i = 0; i < 100000; i++) {
+    assertEquals(expected, re.exec(subject));
+    if (%RegexpHasNativeCode(re, is_latin1)) break;
+  }
+  assertTrue(%RegexpHasNativeCode(re, is_latin1));
+  assertFalse(%RegexpHasBytecode(re, is_latin1));
+  assertEquals(expected, re.exec(subject));
+}
+
+TierUpWhileMatching(/(\d+)-(\d+)/, "tel: 555-1234", ["555-1234", "555", "1234"],
+                    kLatin1);
+TierUpWhileMatching(/(?<word>[a-zé]+)\s\k<word>/iu, "dans Élan élan",
+                    ["Élan élan", "Élan"], kLatin1);
+TierUpWhileMatching(/π+(\w)/, "xππππy", ["ππππy", "y"], kUnicode);
+
+// Global regexps, with matches before and after the switch.
+const global = /[aeiou]/g;
+const subject = "the quick brown fox jumps over the lazy dog";
+for (let i = 0; i < 10000; i++) {
+  assertEquals("th_ q__ck br_wn f_x j_mps _v_r th_ l_zy d_g",
+               subject.replace(global, "_"));
+  if (%RegexpHasNativeCode(global, kLatin1)) break;
+}
+assertEquals(11, subject.match(global).length);
@@ -0,0 +1,64 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --default-to-experimental-regexp-engine
+// Flags: --experimental-regexp-engine-lazy-dfa
+
+// The experimental engine first checks for a match with a lazy DFA and only
+// runs the NFA if there is one.
+
+function Test(regexp, subject, expectedResult) {
+  assertEquals(%RegexpTypeTag(regexp), "EXPERIMENTAL");
+  var result = regexp.exec(subject);
+  if (result instanceof Array && expectedResult instanceof Array) {
+    assertArrayEquals(expectedResult, result);
+  } else {
+    assertEquals(expectedResult, result);
+  }
+}
+
+// Near misses.
+const nearMiss = "GET /api/v1/user".repeat(100);
+Test(/GET \/api\/v2\/[a-z]+/, nearMiss, null);
+Test(/GET \/api\/v1\/user/, nearMiss, ["GET /api/v1/user"]);
+Test(/(\w+)=(\d+);/, "a=b;c=d;".repeat(100), null);
+Test(/(\w+)=(\d+);/, "a=b;".repeat(100) + "c=12;", ["c=12;", "c", "12"]);
+
+// Quantifiers whose iterations must not match the empty string.
+Test(/(?:a*)*b/, "aaaa", null);
+Test(/(?:a*)*b/, "aaab", ["aaab"]);
+Test(/(?:a|)*c/, "aaa", null);
+Test(/(?:a|)*c/, "aac", ["aac"]);
+Test(/a{2,3}b/, "ab aab", ["aab"]);
+
+// Empty matches.
+Test(/x*/, "abc", [""]);
+Test(new RegExp(""), "", [""]);
+
+// Two-byte subjects and classes.
+Test(/[Ā-Ȁ]+z/, "ŐŐy", null);
+Test(/[Ā-Ȁ]+z/, "aŐŐz", ["ŐŐz"]);
+Test(/[^a]b/, "abሴb", ["ሴb"]);
+
+// Sticky and global regexps start at lastIndex.
+var sticky = /ab/y;
+sticky.lastIndex = 1;
+Test(sticky, "xabab", ["ab"]);
+assertEquals(3, sticky.lastIndex);
+sticky.lastIndex = 0;
+Test(sticky, "xabab", null);
+assertEquals(["ab", "ab"], "ab-ab-ac".match(/ab/g));
+assertEquals(null, "ac-ac".match(/ab/g));
+
+// Assertions make the DFA give up, the NFA still finds the match.
+Test(/\bfoo\b/, "foobar foo", ["foo"]);
+Test(/^b/m, "a\nb", ["b"]);
+
+// The DFA is kept on the regexp, and its states are reused across executions.
+var reused = /(\d+)-(\d+)x/;
+for (var i = 0; i < 10; i++) {
+  Test(reused, "12-34y".repeat(10), null);
+  Test(reused, "12-34y".repeat(10) + "5-6x", ["5-6x", "5", "6"]);
+  Test(reused, "ሴ1-2x", ["1-2x", "1", "2"]);
+}
@@ -0,0 +1,51 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --default-to-experimental-regexp-engine
+
+// The experimental engine skips input that can't start a match. Check that
+// matches before, after and in between skipped runs are still found.
+
+function Test(regexp, subject, expectedResult) {
+  assertEquals(%RegexpTypeTag(regexp), "EXPERIMENTAL");
+  var result = regexp.exec(subject);
+  if (result instanceof Array && expectedResult instanceof Array) {
+    assertArrayEquals(expectedResult, result);
+  } else {
+    assertEquals(expectedResult, result);
+  }
+}
+
+const filler = "-".repeat(1000);
+
+Test(/abc/, filler + "abc" + filler, ["abc"]);
+Test(/abc/, "abc" + filler, ["abc"]);
+Test(/abc/, filler + "abc", ["abc"]);
+Test(/abc/, filler + "ab", null);
+Test(/abc/, filler, null);
+Test(/abc/, "", null);
+
+// Failed partial matches right before the real one.
+Test(/abc/, filler + "aababc" + filler, ["abc"]);
+Test(/ab+c/, filler + "abbbabbbbc", ["abbbbc"]);
+
+// Several first characters and captures.
+Test(/(x|y)z/, filler + "xyyz", ["yz", "y"]);
+Test(/[0-9]+px/, filler + "12pt 34px", ["34px"]);
+Test(/(?:foo|bar)(baz)?/, filler + "barbaz", ["barbaz", "baz"]);
+
+// Two-byte subjects.
+Test(/쁰d/, filler + "섊쁰쁰d", ["쁰d"]);
+Test(/[쁰-섊]x/, "ሴ".repeat(100) + "섊x", ["섊x"]);
+
+// Patterns that can't skip anything must still work.
+Test(/.x/, filler + "ax", ["ax"]);
+Test(/a*/, filler, [""]);
+Test(/\bfoo/, filler + "afoo foo", ["foo"]);
+Test(/^abc/m, filler + "\nabc", ["abc"]);
+
+// Global matching restarts the search after each match.
+assertEquals(["ab", "ab", "ab"],
+             (filler + "ab" + filler + "ab" + filler + "ab").match(/ab/g));
+assertEquals(3, (filler + "a1" + filler + "b2c3").match(/[a-c][0-9]/g).length);
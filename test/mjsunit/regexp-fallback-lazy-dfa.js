@@ -0,0 +1,39 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+// Flags: --no-enable-experimental-regexp-engine
+// Flags: --enable-experimental-regexp-engine-on-excessive-backtracks
+// Flags: --experimental-regexp-engine-lazy-dfa
+// Flags: --regexp-tier-up --regexp-tier-up-ticks 1
+
+// After excessive backtracking in irregexp, the experimental engine checks
+// for a match with a lazy DFA that is kept on the regexp across executions.
+let regexp = new RegExp("a+".repeat(100) + "x");
+let match = "a".repeat(100) + "x";
+let miss = "a".repeat(100) + "y";
+
+// Both for the irregexp interpreter and for native irregexp, and again with
+// the DFA states cached from the previous executions.
+for (let i = 0; i < 3; i++) {
+  assertEquals(null, regexp.exec(miss));
+  assertArrayEquals([match], regexp.exec(miss + match));
+  assertEquals(null, regexp.exec(miss.repeat(3)));
+}
+
+// Through the RegExpGlobalCache.
+regexp = new RegExp(regexp.source, "g");
+for (let i = 0; i < 2; i++) {
+  assertEquals(miss + "-" + miss + "-",
+               (miss + match + miss + match).replace(regexp, () => "-"));
+  assertEquals(miss.repeat(2), miss.repeat(2).replace(regexp, () => "-"));
+}
+
+// Captures are still computed by the NFA.
+regexp = new RegExp("(a+)+(b)");
+let subject = "a".repeat(30) + "c" + "a".repeat(3) + "b";
+for (let i = 0; i < 2; i++) {
+  assertArrayEquals(["aaab", "aaa", "b"], regexp.exec(subject));
+  assertEquals(null, regexp.exec("a".repeat(30) + "c"));
+}
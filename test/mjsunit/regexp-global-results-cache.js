@@ -0,0 +1,57 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-global-results-cache --expose-gc
+
+// Global replace and match calls cache their matches per regexp and subject
+// and replay them for equal subjects. Check that replayed results are the
+// same as fresh ones.
+
+function Template(name) {
+  // Build the subject at runtime so that it isn't internalized.
+  return ["Hello {{", name, "}}, you have {{count}} new {{items}}."].join("");
+}
+
+const re = /\{\{(\w+)\}\}/g;
+const values = {name: "Ada", count: "3", items: "messages"};
+for (let i = 0; i < 5; i++) {
+  assertEquals("Hello Ada, you have 3 new messages.",
+               Template("name").replace(re, (m, key) => values[key]));
+  assertEquals("Hello <name>, you have <count> new <items>.",
+               Template("name").replace(re, "<$1>"));
+  assertEquals(["{{name}}", "{{count}}", "{{items}}"],
+               Template("name").match(re));
+  if (i == 2) gc();
+}
+
+// Different subjects and regexps with the same source don't share entries.
+assertEquals("Hello Bob, you have 3 new messages.",
+             Template("name").replace(
+                 re, (m, key) => key == "name" ? "Bob" : values[key]));
+assertEquals("Hello X, you have X new X.",
+             Template("other").replace(/\{\{(\w+)\}\}/g, "X"));
+assertEquals("Hello <other>, you have <count> new <items>.",
+             Template("other").replace(re, "<$1>"));
+
+// The last match info reflects the replayed matches.
+for (let i = 0; i < 3; i++) {
+  Template("name").replace(re, "");
+  assertEquals("items", RegExp.$1);
+  assertEquals(".", RegExp.rightContext);
+}
+
+// Zero-length matches and unicode regexps.
+for (let i = 0; i < 3; i++) {
+  assertEquals("-a-b-c-", ["a", "b", "c"].join("").replace(/x*/g, "-"));
+  assertEquals(["\u{1F600}", "\u{1F600}"],
+               ["\u{1F600}", "\u{1F600}"].join("").match(/./gu));
+}
+
+// Subjects without a match, and with more matches than are cached.
+const long = "ab".repeat(10000);
+for (let i = 0; i < 3; i++) {
+  assertEquals(long, long.replace(/x/g, "y"));
+  assertEquals(10000, long.match(/(a)(b)/g).length);
+  assertEquals("ba".repeat(10000), long.replace(/(a)(b)/g, "$2$1"));
+}
@@ -0,0 +1,54 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-required-literal-prefilter
+
+// Irregexp searches for a literal that every match contains before matching
+// from the runtime, and skips input that can't start a match. Check that no
+// match is lost.
+
+const filler = "-".repeat(100000);
+
+// No occurrence of the required literal.
+assertEquals(filler, filler.replace(/\d+px/g, "X"));
+assertEquals(null, /[a-z]+foo/.exec(filler + "fo"));
+
+// Global replace over long subjects.
+assertEquals(filler + "X" + filler + "X",
+             (filler + "12px" + filler + "3px").replace(/\d+px/g, "X"));
+assertEquals("aXX-X" + filler, ("a1234-99" + filler).replace(/\d{2}/g, "X"));
+assertEquals(["b", "c"], (filler + "a::b::c").split(/::/).slice(1));
+
+// Matches whose start is before the literal.
+assertEquals(["xyabcd"], /[x-z]{2}abcd/.exec(filler + "xyabcd"));
+assertEquals(["abc123"], /abc\d{1,3}/.exec(filler + "abc123"));
+assertEquals(["10px"], (filler + "10px").match(/[0-9]{2}px/g));
+
+// Assertions and lookbehinds look at input before the skip target.
+assertEquals(["foo"], /\bfoo/.exec(filler + "afoo foo"));
+assertEquals(filler.length + 5, (filler + "afoo foo").search(/\bfoo/));
+assertEquals(["b"], /(?<=a)b/.exec(filler + "ab"));
+assertEquals(null, /(?<=x)b/.exec(filler + "ab"));
+assertEquals(null, /^foo/.exec(filler + "foo"));
+assertEquals(["foo"], /^foo/m.exec(filler + "\nfoo"));
+
+// Sticky regexps must not skip.
+const sticky = /a+bc/y;
+sticky.lastIndex = 1;
+assertEquals(null, sticky.exec("-" + filler + "abc"));
+sticky.lastIndex = 1;
+assertEquals(["aabc"], sticky.exec("-aabc" + filler));
+
+// Unicode subjects.
+assertEquals(["\u{1F600}x"], /.x/u.exec(filler + "\u{1F600}x"));
+assertEquals(
+    2, (filler + "\u{1F600}ab\u{1F600}ab").match(/\u{1F600}ab/gu).length);
+
+// Literals at an unbounded offset from the start of the match.
+assertEquals(["aab"], /\w+b/.exec(filler + "aab"));
+assertEquals(["axxb"], /a.*b/.exec(filler + "axxb"));
+assertEquals(null, /a.*b/.exec(filler + "a"));
+
+// Case-insensitive regexps have no required literal.
+assertEquals(["ABC"], /abc/i.exec(filler + "ABC"));
@@ -0,0 +1,284 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --liftoff --no-wasm-tier-up
+// Flags: --no-wasm-lazy-compilation --liftoff-loop-locals-in-registers
+
+// Liftoff keeps some locals in registers when entering a loop. Check that the
+// back-edges move updated values of those locals back into place.
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+(function testI32Locals() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  // Locals: 0 = n, 1 = i, 2 = a, 3 = b.
+  builder.addFunction('main', kSig_i_i)
+      .addLocals(kWasmI32, 3)
+      .addBody([
+        kExprLocalGet, 0, kExprI32Const, 3, kExprI32Mul, kExprLocalSet, 2,
+        kExprLocalGet, 0, kExprI32Const, 5, kExprI32Add, kExprLocalSet, 3,
+        kExprLoop, kWasmVoid,
+          kExprLocalGet, 2, kExprLocalGet, 1, kExprI32Add, kExprLocalSet, 2,
+          kExprLocalGet, 3, kExprLocalGet, 2, kExprI32Const, 1, kExprI32Shl,
+          kExprI32Xor, kExprLocalSet, 3,
+          kExprLocalGet, 1, kExprI32Const, 1, kExprI32Add, kExprLocalTee, 1,
+          kExprLocalGet, 0, kExprI32LtS,
+          kExprBrIf, 0,
+        kExprEnd,
+        kExprLocalGet, 2, kExprLocalGet, 3, kExprI32Xor
+      ])
+      .exportFunc();
+  const instance = builder.instantiate();
+  assertTrue(%IsLiftoffFunction(instance.exports.main));
+
+  function expected(n) {
+    let i = 0, a = Math.imul(n, 3), b = n + 5;
+    do {
+      a = (a + i) | 0;
+      b = b ^ (a << 1);
+      i = (i + 1) | 0;
+    } while (i < n);
+    return a ^ b;
+  }
+  for (const n of [0, 1, 2, 17, 1000]) {
+    assertEquals(expected(n), instance.exports.main(n));
+  }
+})();
+
+(function testI64AndF64Locals() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  // Locals: 0 = x, 1 = i, 2 = acc.
+  builder.addFunction('i64', kSig_l_l)
+      .addLocals(kWasmI32, 1)
+      .addLocals(kWasmI64, 1)
+      .addBody([
+        kExprLocalGet, 0, kExprLocalSet, 2,
+        kExprLoop, kWasmVoid,
+          kExprLocalGet, 2, kExprI64Const, 3, kExprI64Mul,
+          kExprLocalGet, 0, kExprI64Add, kExprLocalSet, 2,
+          kExprLocalGet, 1, kExprI32Const, 1, kExprI32Add, kExprLocalTee, 1,
+          kExprI32Const, 50, kExprI32LtS,
+          kExprBrIf, 0,
+        kExprEnd,
+        kExprLocalGet, 2
+      ])
+      .exportFunc();
+  // Locals: 0 = x, 1 = n, 2 = i, 3 = acc.
+  builder.addFunction('f64', makeSig([kWasmF64, kWasmI32], [kWasmF64]))
+      .addLocals(kWasmI32, 1)
+      .addLocals(kWasmF64, 1)
+      .addBody([
+        kExprLocalGet, 0, kExprLocalSet, 3,
+        kExprLoop, kWasmVoid,
+          kExprLocalGet, 3, kExprLocalGet, 0, kExprLocalGet, 2,
+          kExprF64SConvertI32, kExprF64Mul, kExprF64Add, kExprLocalSet, 3,
+          kExprLocalGet, 2, kExprI32Const, 1, kExprI32Add, kExprLocalTee, 2,
+          kExprLocalGet, 1, kExprI32LtS,
+          kExprBrIf, 0,
+        kExprEnd,
+        kExprLocalGet, 3
+      ])
+      .exportFunc();
+  const instance = builder.instantiate();
+
+  function expected_i64(x) {
+    let acc = x;
+    for (let i = 0; i < 50; i++) acc = BigInt.asIntN(64, acc * 3n + x);
+    return acc;
+  }
+  function expected_f64(x, n) {
+    let acc = x, i = 0;
+    do {
+      acc = acc + x * i;
+      i++;
+    } while (i < n);
+    return acc;
+  }
+  for (const x of [0n, 1n, -7n, 123456789123n]) {
+    assertEquals(expected_i64(x), instance.exports.i64(x));
+  }
+  for (const x of [0, 1.5, -0.25]) {
+    for (const n of [0, 1, 100]) {
+      assertEquals(expected_f64(x, n), instance.exports.f64(x, n));
+    }
+  }
+})();
+
+(function testLocalsSharingARegister() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  // Locals 1 and 2 start out as copies of the parameter.
+  builder.addFunction('main', kSig_i_i)
+      .addLocals(kWasmI32, 2)
+      .addBody([
+        kExprLocalGet, 0, kExprLocalTee, 1, kExprLocalSet, 2,
+        kExprLoop, kWasmVoid,
+          kExprLocalGet, 1, kExprI32Const, 3, kExprI32Add, kExprLocalSet, 1,
+          kExprLocalGet, 2, kExprLocalGet, 1, kExprI32Sub, kExprLocalSet, 2,
+          kExprLocalGet, 0, kExprI32Const, 1, kExprI32Sub, kExprLocalTee, 0,
+          kExprBrIf, 0,
+        kExprEnd,
+        kExprLocalGet, 1, kExprLocalGet, 2, kExprI32Mul
+      ])
+      .exportFunc();
+  const instance = builder.instantiate();
+
+  function expected(n) {
+    let a = n, b = n;
+    do {
+      a = (a + 3) | 0;
+      b = (b - a) | 0;
+      n = (n - 1) | 0;
+    } while (n != 0);
+    return Math.imul(a, b);
+  }
+  for (const n of [1, 2, 33]) {
+    assertEquals(expected(n), instance.exports.main(n));
+  }
+})();
+
+(function testCallInLoop() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  const imp = builder.addImport('m', 'f', kSig_i_i);
+  const inc = builder.addFunction('inc', kSig_i_i)
+      .addBody([kExprLocalGet, 0, kExprI32Const, 1, kExprI32Add]);
+  // Locals: 0 = n, 1 = i, 2 = a, 3 = b.
+  builder.addFunction('main', kSig_i_i)
+      .addLocals(kWasmI32, 3)
+      .addBody([
+        kExprLocalGet, 0, kExprI32Const, 7, kExprI32Add, kExprLocalSet, 2,
+        kExprLocalGet, 0, kExprI32Const, 9, kExprI32Mul, kExprLocalSet, 3,
+        kExprLoop, kWasmVoid,
+          kExprLocalGet, 2, kExprCallFunction, imp, kExprLocalSet, 2,
+          kExprLocalGet, 3, kExprLocalGet, 2, kExprI32Add, kExprLocalSet, 3,
+          kExprLocalGet, 1, kExprCallFunction, inc.index, kExprLocalTee, 1,
+          kExprLocalGet, 0, kExprI32LtS,
+          kExprBrIf, 0,
+        kExprEnd,
+        kExprLocalGet, 2, kExprLocalGet, 3, kExprI32Xor
+      ])
+      .exportFunc();
+  const instance = builder.instantiate({m: {f: x => (x * 5 + 1) | 0}});
+
+  function expected(n) {
+    let i = 0, a = n + 7, b = Math.imul(n, 9);
+    do {
+      a = (a * 5 + 1) | 0;
+      b = (b + a) | 0;
+      i++;
+    } while (i < n);
+    return a ^ b;
+  }
+  for (const n of [0, 1, 10]) {
+    assertEquals(expected(n), instance.exports.main(n));
+  }
+})();
+
+(function testManyLocals() {
+  print(arguments.callee.name);
+  // More live locals than there are cache registers.
+  const kNumLocals = 24;
+  const builder = new WasmModuleBuilder();
+  const body = [];
+  // Local k (1 <= k <= kNumLocals) starts out as n + k.
+  for (let k = 1; k <= kNumLocals; k++) {
+    body.push(kExprLocalGet, 0, ...wasmI32Const(k), kExprI32Add,
+              kExprLocalSet, k);
+  }
+  // Each iteration adds local k - 1 to local k, then decrements n.
+  body.push(kExprLoop, kWasmVoid);
+  for (let k = kNumLocals; k > 1; k--) {
+    body.push(kExprLocalGet, k, kExprLocalGet, k - 1, kExprI32Add,
+              kExprLocalSet, k);
+  }
+  body.push(kExprLocalGet, 0, kExprI32Const, 1, kExprI32Sub,
+            kExprLocalTee, 0, kExprI32Const, 0, kExprI32GtS,
+            kExprBrIf, 0,
+            kExprEnd);
+  body.push(kExprLocalGet, 1);
+  for (let k = 2; k <= kNumLocals; k++) {
+    body.push(kExprLocalGet, k, kExprI32Xor);
+  }
+  builder.addFunction('main', kSig_i_i)
+      .addLocals(kWasmI32, kNumLocals)
+      .addBody(body)
+      .exportFunc();
+  const instance = builder.instantiate();
+
+  function expected(n) {
+    const locals = [n];
+    for (let k = 1; k <= kNumLocals; k++) locals.push(n + k);
+    do {
+      for (let k = kNumLocals; k > 1; k--) {
+        locals[k] = (locals[k] + locals[k - 1]) | 0;
+      }
+      n = (n - 1) | 0;
+    } while (n > 0);
+    let result = locals[1];
+    for (let k = 2; k <= kNumLocals; k++) result ^= locals[k];
+    return result;
+  }
+  for (const n of [0, 1, 5, 50]) {
+    assertEquals(expected(n), instance.exports.main(n));
+  }
+})();
+
+(function testNestedLoops() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  // Locals: 0 = n, 1 = i, 2 = j, 3 = sum.
+  builder.addFunction('main', kSig_i_i)
+      .addLocals(kWasmI32, 3)
+      .addBody([
+        kExprLocalGet, 0, kExprLocalSet, 3,
+        kExprLoop, kWasmVoid,
+          kExprI32Const, 0, kExprLocalSet, 2,
+          kExprLoop, kWasmVoid,
+            kExprLocalGet, 3, kExprLocalGet, 1, kExprLocalGet, 2,
+            kExprI32Mul, kExprI32Add, kExprLocalSet, 3,
+            // Skip the rest of the outer iteration for odd sums.
+            kExprLocalGet, 3, kExprI32Const, 1, kExprI32And,
+            kExprIf, kWasmVoid,
+              kExprLocalGet, 1, kExprI32Const, 1, kExprI32Add, kExprLocalTee, 1,
+              kExprLocalGet, 0, kExprI32LtS,
+              kExprBrIf, 2,
+              kExprLocalGet, 3, kExprReturn,
+            kExprEnd,
+            kExprLocalGet, 2, kExprI32Const, 1, kExprI32Add, kExprLocalTee, 2,
+            kExprLocalGet, 1, kExprI32LtS,
+            kExprBrIf, 0,
+          kExprEnd,
+          kExprLocalGet, 1, kExprI32Const, 1, kExprI32Add, kExprLocalTee, 1,
+          kExprLocalGet, 0, kExprI32LtS,
+          kExprBrIf, 0,
+        kExprEnd,
+        kExprLocalGet, 3
+      ])
+      .exportFunc();
+  const instance = builder.instantiate();
+
+  function expected(n) {
+    let i = 0, sum = n;
+    outer: do {
+      let j = 0;
+      do {
+        sum = (sum + Math.imul(i, j)) | 0;
+        if (sum & 1) {
+          i = (i + 1) | 0;
+          if (i < n) continue outer;
+          return sum;
+        }
+        j = (j + 1) | 0;
+      } while (j < i);
+      i = (i + 1) | 0;
+    } while (i < n);
+    return sum;
+  }
+  for (const n of [0, 1, 2, 3, 10, 41]) {
+    assertEquals(expected(n), instance.exports.main(n));
+  }
+})();
@@ -0,0 +1,90 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --experimental-wasm-memory64 --turboshaft-wasm --no-liftoff
+// Flags: --wasm-enforce-bounds-checks
+// Flags: --turboshaft-wasm-bounds-check-elimination
+
+// Explicit bounds checks that are implied by a dominating check on the same
+// index are removed. Check that all out-of-bounds accesses still trap.
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+function load(offset) {
+  return [kExprI32LoadMem, 2, ...wasmUnsignedLeb(offset)];
+}
+
+function instantiate(body) {
+  const builder = new WasmModuleBuilder();
+  builder.addMemory64(1, 1);
+  builder.exportMemoryAs('memory');
+  builder.addFunction('main', kSig_i_l).addBody(body).exportFunc();
+  const instance = builder.instantiate();
+  const words = new Int32Array(instance.exports.memory.buffer);
+  for (let i = 0; i < words.length; i++) words[i] = i;
+  return instance.exports.main;
+}
+
+const kEnd = BigInt(kPageSize);
+
+(function testLargestOffsetFirst() {
+  print(arguments.callee.name);
+  // The checks for offsets 0 and 4 are implied by the one for offset 8.
+  const main = instantiate([
+    kExprLocalGet, 0, ...load(8),
+    kExprLocalGet, 0, ...load(0), kExprI32Add,
+    kExprLocalGet, 0, ...load(4), kExprI32Add,
+  ]);
+  assertEquals(3 + 4 + 5, main(12n));
+  const last = kPageSize / 4 - 3;
+  assertEquals(3 * last + 3, main(kEnd - 12n));
+  for (const p of [kEnd - 11n, kEnd - 8n, kEnd - 1n, kEnd, 1n << 40n, -1n]) {
+    assertTraps(kTrapMemOutOfBounds, () => main(p));
+  }
+})();
+
+(function testLargestOffsetLast() {
+  print(arguments.callee.name);
+  // The check for offset 8 is not implied by the one for offset 0.
+  const main = instantiate([
+    kExprLocalGet, 0, ...load(0),
+    kExprLocalGet, 0, ...load(8), kExprI32Add,
+  ]);
+  assertEquals(3 + 5, main(12n));
+  for (const p of [kEnd - 11n, kEnd - 8n, kEnd - 4n, kEnd]) {
+    assertTraps(kTrapMemOutOfBounds, () => main(p));
+  }
+})();
+
+(function testIndexPlusConstant() {
+  print(arguments.callee.name);
+  // The check for {p + 4} is implied by the check for {p} with offset 12, the
+  // one for {p + 8} with offset 8 is not.
+  const main = instantiate([
+    kExprLocalGet, 0, ...load(12),
+    kExprLocalGet, 0, ...wasmI64Const(4), kExprI64Add, ...load(0),
+    kExprI32Add,
+    kExprLocalGet, 0, ...wasmI64Const(8), kExprI64Add, ...load(8),
+    kExprI32Add,
+  ]);
+  assertEquals(6 + 4 + 7, main(12n));
+  for (const p of [kEnd - 16n, kEnd - 15n, kEnd - 8n, -4n, -8n]) {
+    assertTraps(kTrapMemOutOfBounds, () => main(p));
+  }
+})();
+
+(function testChecksInBranch() {
+  print(arguments.callee.name);
+  // The check in the branch does not dominate the access after it.
+  const main = instantiate([
+    kExprLocalGet, 0, kExprI64Eqz,
+    kExprIf, kWasmVoid,
+      kExprLocalGet, 0, ...load(16), kExprDrop,
+    kExprEnd,
+    kExprLocalGet, 0, ...load(8),
+  ]);
+  assertEquals(3, main(4n));
+  assertEquals(2, main(0n));
+  assertTraps(kTrapMemOutOfBounds, () => main(kEnd - 8n));
+})();
@@ -0,0 +1,43 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --wasm-position-independent-calls --allow-natives-syntax
+// Flags: --expose-gc --no-liftoff --no-wasm-lazy-compilation
+// Flags: --no-wasm-inlining
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+function buildModule() {
+  const builder = new WasmModuleBuilder();
+  const add = builder.addFunction('add', kSig_i_ii)
+      .addBody([kExprLocalGet, 0, kExprLocalGet, 1, kExprI32Add]);
+  builder.addFunction('call', kSig_i_ii)
+      .addBody([kExprLocalGet, 0, kExprLocalGet, 1, kExprCallFunction,
+                add.index])
+      .exportFunc();
+  builder.addFunction('tail_call', kSig_i_ii)
+      .addBody([kExprLocalGet, 0, kExprLocalGet, 1, kExprReturnCall,
+                add.index])
+      .exportFunc();
+  return builder.toBuffer();
+}
+
+(function DirectCalls() {
+  print(arguments.callee.name);
+  const instance = new WebAssembly.Instance(
+      new WebAssembly.Module(buildModule()));
+  assertEquals(5, instance.exports.call(2, 3));
+  assertEquals(7, instance.exports.tail_call(3, 4));
+})();
+
+(function DirectCallsAfterDeserialization() {
+  print(arguments.callee.name);
+  const wire_bytes = buildModule();
+  const buff = %SerializeWasmModule(new WebAssembly.Module(wire_bytes));
+  gc();
+  const module = %DeserializeWasmModule(buff, wire_bytes);
+  const instance = new WebAssembly.Instance(module);
+  assertEquals(5, instance.exports.call(2, 3));
+  assertEquals(7, instance.exports.tail_call(3, 4));
+})();
@@ -0,0 +1,49 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --wasm-dynamic-tiering --liftoff
+// Flags: --wasm-sampling-tier-up --wasm-sampling-tier-up-interval=100
+// Liftoff code does not check tiering budgets with --wasm-sampling-tier-up,
+// so this budget must not trigger tier-up:
+// Flags: --wasm-tiering-budget=1
+
+// This test busy-waits for tier-up to be complete, hence it does not work in
+// predictable mode where we only have a single thread.
+// Flags: --no-predictable
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+const builder = new WasmModuleBuilder();
+builder.addFunction('cold', kSig_i_i)
+    .addBody([kExprLocalGet, 0, kExprI32Const, 1, kExprI32Add])
+    .exportFunc();
+// Locals: 0 = n, 1 = sum.
+builder.addFunction('hot', kSig_i_i)
+    .addLocals(kWasmI32, 1)
+    .addBody([
+      kExprLoop, kWasmVoid,
+        kExprLocalGet, 1, kExprLocalGet, 0, kExprI32Add, kExprLocalSet, 1,
+        kExprLocalGet, 0, kExprI32Const, 1, kExprI32Sub, kExprLocalTee, 0,
+        kExprBrIf, 0,
+      kExprEnd,
+      kExprLocalGet, 1
+    ])
+    .exportFunc();
+
+const instance = builder.instantiate();
+
+for (let i = 0; i < 10; ++i) {
+  assertEquals(i + 1, instance.exports.cold(i));
+  assertEquals(55, instance.exports.hot(10));
+}
+assertTrue(%IsLiftoffFunction(instance.exports.cold));
+assertTrue(%IsLiftoffFunction(instance.exports.hot));
+
+// Keep running the loop until sampling detects the function as hot.
+while (%IsLiftoffFunction(instance.exports.hot)) {
+  assertEquals(50005000, instance.exports.hot(10000));
+}
+assertTrue(%IsTurboFanFunction(instance.exports.hot));
+assertTrue(%IsLiftoffFunction(instance.exports.cold));
+assertEquals(55, instance.exports.hot(10));
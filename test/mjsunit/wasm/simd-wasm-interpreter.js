@@ -55,3 +55,80 @@ d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
   var instance = builder.instantiate({o: {g: gint}});
   instance.exports.main();
 })();
+
+// Tests the fused s128.load + s128.store super-instruction, with different
+// load and store offsets.
+(function testSimdLoadStoreMem() {
+  print(arguments.callee.name);
+
+  const builder = new WasmModuleBuilder();
+  builder.addMemory(1, 1);
+  builder.exportMemoryAs('memory');
+  // (dst, src, n): copies n bytes in 16-byte chunks.
+  builder.addFunction('copy', kSig_v_iii)
+    .addLocals(kWasmI32, 1)
+    .exportFunc()
+    .addBody([
+      kExprBlock, kWasmVoid,
+        kExprLoop, kWasmVoid,
+          kExprLocalGet, 3, kExprLocalGet, 2, kExprI32GeU,
+          kExprBrIf, 1,
+          kExprLocalGet, 0, kExprLocalGet, 3, kExprI32Add,
+          kExprLocalGet, 1, kExprLocalGet, 3, kExprI32Add,
+          kSimdPrefix, kExprS128LoadMem, 0, 4,   // s128.load offset=4
+          kSimdPrefix, kExprS128StoreMem, 0, 8,  // s128.store offset=8
+          kExprLocalGet, 3, kExprI32Const, 16, kExprI32Add, kExprLocalSet, 3,
+          kExprBr, 0,
+        kExprEnd,
+      kExprEnd,
+    ]);
+  const instance = builder.instantiate();
+  const memory = new Uint8Array(instance.exports.memory.buffer);
+  for (let i = 0; i < 256; i++) memory[i] = i;
+
+  instance.exports.copy(1024, 16, 64);
+  for (let i = 0; i < 64; i++) {
+    assertEquals(16 + 4 + i, memory[1024 + 8 + i]);
+  }
+  assertEquals(0, memory[1024 + 7]);
+  assertEquals(0, memory[1024 + 8 + 64]);
+
+  // Out-of-bounds store, then out-of-bounds load.
+  assertTraps(kTrapMemOutOfBounds,
+              () => instance.exports.copy(kPageSize - 16, 0, 16));
+  assertTraps(kTrapMemOutOfBounds,
+              () => instance.exports.copy(0, kPageSize - 16, 16));
+  assertTraps(kTrapMemOutOfBounds,
+              () => instance.exports.copy(0xfffffff8, 0, 16));
+})();
+
+// Tests the fused s128.load + local.set super-instruction.
+(function testSimdLoadMemLocalSet() {
+  print(arguments.callee.name);
+
+  const builder = new WasmModuleBuilder();
+  builder.addMemory(1, 1);
+  builder.exportMemoryAs('memory');
+  // (addr) -> lane 0 + lane 3 of the s128 value at addr + 8.
+  builder.addFunction('main', kSig_i_i)
+    .addLocals(kWasmS128, 1)
+    .exportFunc()
+    .addBody([
+      kExprLocalGet, 0,
+      kSimdPrefix, kExprS128LoadMem, 0, 8,  // s128.load offset=8
+      kExprLocalSet, 1,
+      kExprLocalGet, 1,
+      kSimdPrefix, kExprI32x4ExtractLane, 0,
+      kExprLocalGet, 1,
+      kSimdPrefix, kExprI32x4ExtractLane, 3,
+      kExprI32Add,
+    ]);
+  const instance = builder.instantiate();
+  const memory = new Int32Array(instance.exports.memory.buffer);
+  for (let i = 0; i < 64; i++) memory[i] = i * 1000;
+
+  assertEquals(2000 + 5000, instance.exports.main(0));
+  assertEquals(6000 + 9000, instance.exports.main(16));
+  assertTraps(kTrapMemOutOfBounds,
+              () => instance.exports.main(kPageSize - 16));
+})();
@@ -0,0 +1,29 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --expose-wasm --wasm-math-intrinsics --turboshaft-wasm
+// Flags: --no-liftoff --wasm-lazy-compilation
+
+// Math imports are well-known imports; Turbofan replaces calls to them by the
+// corresponding Wasm instructions. With lazy compilation, the functions only
+// get compiled after instantiation, so the imports are known already.
+d8.file.execute('test/mjsunit/wasm/wasm-math-intrinsic.js');
+
+(function TestConflictingImports() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  const sqrt = builder.addImport('m', 'sqrt', kSig_d_d);
+  builder.addFunction('main', kSig_d_d)
+      .addBody([kExprLocalGet, 0, kExprCallFunction, sqrt])
+      .exportFunc();
+  const module = builder.toModule();
+
+  const instance1 = new WebAssembly.Instance(module, {m: {sqrt: Math.sqrt}});
+  assertEquals(3, instance1.exports.main(9));
+  // Instantiating the module with a different import must not reuse the code
+  // which inlined Math.sqrt, neither for the new nor for the old instance.
+  const instance2 = new WebAssembly.Instance(module, {m: {sqrt: x => x + 1}});
+  assertEquals(10, instance2.exports.main(9));
+  assertEquals(3, instance1.exports.main(9));
+})();
@@ -21,6 +21,7 @@
 #include "src/parsing/parsing.h"
 #include "src/parsing/scanner-character-streams.h"
 #include "src/zone/zone-list-inl.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/test-helpers.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -789,6 +790,43 @@ TEST_F(LazyCompileDispatcherTest, CompileLazy2FinishesDispatcherJob) {
   ASSERT_FALSE(dispatcher->IsEnqueued(shared_2));
 }
 
+TEST_F(LazyCompileDispatcherTest, ParallelCompileTasksForLazyToplevel) {
+  FLAG_SCOPE(parallel_compile_tasks_for_lazy_toplevel);
+  FLAG_VALUE_SCOPE(parallel_compile_tasks_min_function_size, 64);
+  // The parser posts its tasks to the isolate's dispatcher.
+  LazyCompileDispatcher* dispatcher = i_isolate()->lazy_compile_dispatcher();
+  dispatcher->AbortAll();
+  DEBUG_ASSERT_EQ(dispatcher->all_jobs_.size(), 0u);
+
+  const char raw_script[] =
+      "function small() { return 1; }\n"
+      "function large() {\n"
+      "  var result = 0;\n"
+      "  for (var i = 0; i < 10; i++) result += i;\n"
+      "  return result;\n"
+      "}\n"
+      "[small, large];";
+  test::ScriptResource* script = new test::ScriptResource(
+      raw_script, strlen(raw_script), JSParameterCount(0));
+  RunJS(script);
+  DirectHandle<JSFunction> small = RunJS<JSFunction>("small");
+  DirectHandle<JSFunction> large = RunJS<JSFunction>("large");
+  Handle<SharedFunctionInfo> small_shared(small->shared(), i_isolate());
+  Handle<SharedFunctionInfo> large_shared(large->shared(), i_isolate());
+  ASSERT_FALSE(small_shared->is_compiled());
+  ASSERT_FALSE(large_shared->is_compiled());
+
+  // Only the function above the size threshold got a task.
+  DEBUG_ASSERT_EQ(dispatcher->all_jobs_.size(), 1u);
+  ASSERT_FALSE(dispatcher->IsEnqueued(small_shared));
+  ASSERT_TRUE(dispatcher->IsEnqueued(large_shared));
+
+  RunJS("large();");
+  ASSERT_TRUE(large_shared->is_compiled());
+  ASSERT_FALSE(dispatcher->IsEnqueued(large_shared));
+  DEBUG_ASSERT_EQ(dispatcher->all_jobs_.size(), 0u);
+}
+
 TEST_F(LazyCompileDispatcherTest, CompileMultipleOnBackgroundThread) {
   MockPlatform platform;
   LazyCompileDispatcher dispatcher(i_isolate(), &platform, v8_flags.stack_size);
@@ -0,0 +1,111 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/turboshaft/wasm-bounds-check-elimination-reducer.h"
+
+#include "src/compiler/turboshaft/assembler.h"
+#include "src/compiler/turboshaft/copying-phase.h"
+#include "src/compiler/turboshaft/operations.h"
+#include "src/compiler/turboshaft/representations.h"
+#include "test/common/flag-utils.h"
+#include "test/unittests/compiler/turboshaft/reducer-test.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+#include "src/compiler/turboshaft/define-assembler-macros.inc"
+
+class WasmBoundsCheckEliminationReducerTest : public ReducerTest {
+ public:
+  WasmBoundsCheckEliminationReducerTest()
+      : ReducerTest(),
+        flag_bounds_check_elimination_(
+            &v8_flags.turboshaft_wasm_bounds_check_elimination, true) {}
+
+ private:
+  const FlagScope<bool> flag_bounds_check_elimination_;
+};
+
+// Emits an explicit bounds check like {BoundsCheckMem} in the Turboshaft graph
+// builder.
+static void BoundsCheck(TestInstance& Asm, V<WordPtr> index,
+                        V<WordPtr> memory_size, uintptr_t end_offset) {
+  __ TrapIfNot(
+      __ UintPtrLessThan(index, __ WordPtrSub(memory_size, end_offset)),
+      TrapId::kTrapMemOutOfBounds);
+}
+
+TEST_F(WasmBoundsCheckEliminationReducerTest, SmallerEndOffset) {
+  auto test = CreateFromGraph(2, [](auto& Asm) {
+    V<WordPtr> index = __ BitcastTaggedToWordPtr(Asm.GetParameter(0));
+    V<WordPtr> memory_size = __ BitcastTaggedToWordPtr(Asm.GetParameter(1));
+    BoundsCheck(Asm, index, memory_size, 7);
+    // Implied by the first check.
+    BoundsCheck(Asm, index, memory_size, 3);
+    BoundsCheck(Asm, index, memory_size, 7);
+    // Not implied.
+    BoundsCheck(Asm, index, memory_size, 15);
+    // Implied by the previous check.
+    BoundsCheck(Asm, index, memory_size, 11);
+    __ Return(__ Word32Constant(0));
+  });
+
+  test.Run<WasmBoundsCheckEliminationReducer>();
+  ASSERT_EQ(test.CountOp(Opcode::kTrapIf), 2u);
+}
+
+TEST_F(WasmBoundsCheckEliminationReducerTest, IndexPlusConstant) {
+  auto test = CreateFromGraph(2, [](auto& Asm) {
+    V<WordPtr> index = __ BitcastTaggedToWordPtr(Asm.GetParameter(0));
+    V<WordPtr> memory_size = __ BitcastTaggedToWordPtr(Asm.GetParameter(1));
+    BoundsCheck(Asm, index, memory_size, 15);
+    // Implied: 8 + 7 <= 15.
+    BoundsCheck(Asm, __ WordPtrAdd(index, 8), memory_size, 7);
+    // Not implied: 8 + 8 > 15.
+    BoundsCheck(Asm, __ WordPtrAdd(index, 8), memory_size, 8);
+    __ Return(__ Word32Constant(0));
+  });
+
+  test.Run<WasmBoundsCheckEliminationReducer>();
+  ASSERT_EQ(test.CountOp(Opcode::kTrapIf), 2u);
+}
+
+TEST_F(WasmBoundsCheckEliminationReducerTest, DifferentMemorySize) {
+  auto test = CreateFromGraph(3, [](auto& Asm) {
+    V<WordPtr> index = __ BitcastTaggedToWordPtr(Asm.GetParameter(0));
+    V<WordPtr> memory_size = __ BitcastTaggedToWordPtr(Asm.GetParameter(1));
+    V<WordPtr> other_size = __ BitcastTaggedToWordPtr(Asm.GetParameter(2));
+    BoundsCheck(Asm, index, memory_size, 7);
+    BoundsCheck(Asm, index, other_size, 7);
+    __ Return(__ Word32Constant(0));
+  });
+
+  test.Run<WasmBoundsCheckEliminationReducer>();
+  ASSERT_EQ(test.CountOp(Opcode::kTrapIf), 2u);
+}
+
+TEST_F(WasmBoundsCheckEliminationReducerTest, OnlyDominatingChecks) {
+  auto test = CreateFromGraph(2, [](auto& Asm) {
+    V<WordPtr> index = __ BitcastTaggedToWordPtr(Asm.GetParameter(0));
+    V<WordPtr> memory_size = __ BitcastTaggedToWordPtr(Asm.GetParameter(1));
+    IF (__ TruncateWordPtrToWord32(index)) {
+      BoundsCheck(Asm, index, memory_size, 7);
+      // Implied by the check in the same branch.
+      BoundsCheck(Asm, index, memory_size, 0);
+    }
+    // Not implied, the check in the branch does not dominate the merge.
+    BoundsCheck(Asm, index, memory_size, 0);
+    IF (__ TruncateWordPtrToWord32(memory_size)) {
+      // Implied by the check before the branch.
+      BoundsCheck(Asm, index, memory_size, 0);
+    }
+    __ Return(__ Word32Constant(0));
+  });
+
+  test.Run<WasmBoundsCheckEliminationReducer>();
+  ASSERT_EQ(test.CountOp(Opcode::kTrapIf), 2u);
+}
+
+#include "src/compiler/turboshaft/undef-assembler-macros.inc"
+
+}  // namespace v8::internal::compiler::turboshaft
@@ -21,6 +21,9 @@ class SwissTableGroupTest : public testing::Test {};
 using GroupTypes = testing::Types<
 #if V8_SWISS_TABLE_HAVE_SSE2_HOST
     GroupSse2Impl,
+#endif
+#if V8_SWISS_TABLE_HAVE_NEON_HOST
+    GroupNeonImpl,
 #endif
     GroupSse2Polyfill, GroupPortableImpl>;
 TYPED_TEST_SUITE(SwissTableGroupTest, GroupTypes);
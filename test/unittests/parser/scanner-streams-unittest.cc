@@ -354,6 +354,41 @@ TEST_F(ScannerStreamsTest, Utf8AdvanceUntilOverChunkBoundaries) {
   }
 }
 
+TEST_F(ScannerStreamsTest, Utf8SeekOverAsciiRuns) {
+  // Seeking in a utf-8 stream skips runs of ascii bytes in bulk, so mix ascii
+  // runs of all lengths with multi-byte characters.
+  std::string utf8;
+  std::vector<uint16_t> ucs2;
+  for (int i = 0; i < 100; i++) {
+    for (int j = 0; j < i; j++) {
+      char c = static_cast<char>('a' + j % 26);
+      utf8 += c;
+      ucs2.push_back(c);
+    }
+    utf8 += "\xC3\xA4";  // U+00E4, two bytes in utf-8.
+    ucs2.push_back(0xE4);
+  }
+
+  // Use increasingly large chunks, so that multi-byte characters get split
+  // across chunk boundaries.
+  ChunkSource chunk_source(reinterpret_cast<const uint8_t*>(utf8.data()), 1,
+                           utf8.length(), true);
+  std::unique_ptr<v8::internal::Utf16CharacterStream> stream(
+      v8::internal::ScannerStream::For(
+          &chunk_source, v8::ScriptCompiler::StreamedSource::UTF8));
+  for (uint16_t c : ucs2) CHECK_EQ(c, stream->Advance());
+  CHECK_EQ(v8::internal::Utf16CharacterStream::kEndOfInput, stream->Advance());
+
+  for (size_t pos = 0; pos < ucs2.size(); pos += 7) {
+    std::unique_ptr<v8::internal::Utf16CharacterStream> clone =
+        stream->Clone();
+    clone->Seek(pos);
+    for (size_t i = pos; i < std::min(pos + 20, ucs2.size()); i++) {
+      CHECK_EQ(ucs2[i], clone->Advance());
+    }
+  }
+}
+
 TEST_F(ScannerStreamsTest, Utf8ChunkBoundaries) {
   // Test utf-8 parsing at chunk boundaries.
 
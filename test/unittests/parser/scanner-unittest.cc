@@ -155,5 +155,55 @@ TEST_F(ScannerTest, PeekAheadAheadAwaitExpression) {
   CHECK_TOK(tokens[3], scanner->PeekAheadAhead());
 }
 
+TEST_F(ScannerTest, LongStringLiteralsAndComments) {
+  // String literals and comments are skipped in blocks of several characters,
+  // so put the interesting characters at every offset within a block.
+  for (size_t padding_length = 0; padding_length < 40; padding_length++) {
+    std::string padding(padding_length, 'a');
+
+    std::string escaped_string = "'" + padding + "\\n" + padding + "\"'x";
+    {
+      auto scanner = make_scanner(escaped_string.c_str());
+      CHECK_TOK(Token::kString, scanner->Next());
+      CHECK_EQ(static_cast<int>(escaped_string.length() - 1),
+               scanner->location().end_pos);
+      CHECK_TOK(Token::kIdentifier, scanner->Next());
+      CHECK_TOK(Token::kEos, scanner->Next());
+    }
+
+    std::string non_ascii_string = "'" + padding + "\xC3\xA4" + padding + "'";
+    {
+      auto scanner = make_scanner(non_ascii_string.c_str());
+      CHECK_TOK(Token::kString, scanner->Next());
+      CHECK_TOK(Token::kEos, scanner->Next());
+    }
+
+    std::string unterminated_string = "'" + padding + "\n'";
+    {
+      auto scanner = make_scanner(unterminated_string.c_str());
+      CHECK_TOK(Token::kIllegal, scanner->Next());
+    }
+
+    std::string single_line_comment = "x // " + padding + "\ny";
+    {
+      auto scanner = make_scanner(single_line_comment.c_str());
+      CHECK_TOK(Token::kIdentifier, scanner->Next());
+      CHECK(scanner->HasLineTerminatorBeforeNext());
+      CHECK_TOK(Token::kIdentifier, scanner->Next());
+      CHECK_TOK(Token::kEos, scanner->Next());
+    }
+
+    std::string multi_line_comment = "x /*\n" + padding + "* *" + padding +
+                                     "**/ y";
+    {
+      auto scanner = make_scanner(multi_line_comment.c_str());
+      CHECK_TOK(Token::kIdentifier, scanner->Next());
+      CHECK(scanner->HasLineTerminatorBeforeNext());
+      CHECK_TOK(Token::kIdentifier, scanner->Next());
+      CHECK_TOK(Token::kEos, scanner->Next());
+    }
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -63,6 +63,25 @@ TEST_F(TestWithNativeContext, ConvertRegExpFlagsToStringAllFlags) {
   EXPECT_TRUE(String::Equals(isolate(), flags, converted_flags));
 }
 
+TEST_F(TestWithNativeContext, RequiredLiteralNeedsBoundedOffset) {
+  FlagScope<bool> prefilter(&v8_flags.regexp_required_literal_prefilter,
+                            true);
+  // RegExpTree::kInfinity may fit in a Smi, so the check for it must not rely
+  // on the Smi range.
+  RunJS(
+      "let bounded = /[0-9]{2}px/; bounded.exec('-12px');"
+      "let unbounded = /\\w+b/; unbounded.exec('-aab');"
+      "let leading = /a.*b/; leading.exec('-axxb');");
+  auto required_literal = [&](const char* name) {
+    DirectHandle<JSRegExp> regexp = RunJS<JSRegExp>(name);
+    return Cast<IrRegExpData>(regexp->data(isolate()))->required_literal();
+  };
+  EXPECT_TRUE(IsString(required_literal("bounded")));
+  EXPECT_FALSE(IsString(required_literal("unbounded")));
+  // The leading "a" is at offset 0, even though "b" is unbounded.
+  EXPECT_TRUE(IsString(required_literal("leading")));
+}
+
 using RegExpTest = TestWithIsolate;
 
 static bool CheckParse(const char* input) {
@@ -434,6 +453,53 @@ TEST_F(RegExpTest, ParserRegression) {
   CheckParseEq("a|", "(| 'a' %)");
 }
 
+static void CheckRequiredLiteral(const char* input, const char* expected,
+                                 int expected_max_offset,
+                                 RegExpFlags flags = {}) {
+  Isolate* isolate = reinterpret_cast<i::Isolate*>(v8::Isolate::GetCurrent());
+
+  v8::HandleScope scope(v8::Isolate::GetCurrent());
+  Zone zone(isolate->allocator(), ZONE_NAME);
+  DirectHandle<String> str =
+      isolate->factory()->NewStringFromAsciiChecked(input);
+  RegExpCompileData result;
+  CHECK(RegExpParser::ParseRegExpFromHeapString(isolate, &zone, str, flags,
+                                                &result));
+  ZoneList<base::uc16> literal(0, &zone);
+  int max_offset = 0;
+  bool found = RegExpCompiler::FindRequiredLiteral(result.tree, flags, &zone,
+                                                   &literal, &max_offset);
+  if (expected == nullptr) {
+    CHECK(!found);
+    return;
+  }
+  CHECK(found);
+  CHECK_EQ(static_cast<int>(strlen(expected)), literal.length());
+  for (int i = 0; i < literal.length(); i++) {
+    CHECK_EQ(expected[i], literal[i]);
+  }
+  CHECK_EQ(expected_max_offset, max_offset);
+}
+
+TEST_F(RegExpTest, RequiredLiteral) {
+  constexpr int kInfinity = RegExpTree::kInfinity;
+  CheckRequiredLiteral("abc", "abc", 0);
+  CheckRequiredLiteral("x+abc", "abc", kInfinity);
+  CheckRequiredLiteral("[0-9]{2}px", "px", 2);
+  CheckRequiredLiteral("ab[cd]efg", "efg", 3);
+  CheckRequiredLiteral("(foo|bar)baz", "baz", 3);
+  CheckRequiredLiteral("(?:abc)+d", "abc", 0);
+  CheckRequiredLiteral("\\d+foo\\d", "foo", kInfinity);
+  CheckRequiredLiteral("(a)\\1bcd", "bcd", kInfinity);
+  // Zero-width assertions don't separate literals.
+  CheckRequiredLiteral("a\\bbc", "abc", 0);
+  CheckRequiredLiteral("x?(?=xyz)ab$", "ab", 1);
+  CheckRequiredLiteral("a|b", nullptr, 0);
+  CheckRequiredLiteral("a*", nullptr, 0);
+  CheckRequiredLiteral("(?:ab)?", nullptr, 0);
+  CheckRequiredLiteral("abc", nullptr, 0, RegExpFlag::kIgnoreCase);
+}
+
 static void ExpectError(const char* input, const char* expected,
                         bool unicode = false) {
   Isolate* isolate = reinterpret_cast<i::Isolate*>(v8::Isolate::GetCurrent());
@@ -560,5 +560,51 @@ GC_INSIDE_NEW_STRING_FROM_UTF8_SUB_STRING(
 
 #undef GC_INSIDE_NEW_STRING_FROM_UTF8_SUB_STRING
 
+TEST(UnicodeTest, NonAsciiStart) {
+  // Place a single non-ascii byte at every offset and alignment, and check
+  // that NonAsciiStart never skips it and never stops before an aligned word
+  // that contains it.
+  static constexpr int kLength = 80;
+  uint8_t buffer[kLength + kIntptrSize];
+  for (int offset = 0; offset < static_cast<int>(kIntptrSize); offset++) {
+    uint8_t* chars = buffer + offset;
+    memset(chars, 'a', kLength);
+    CHECK_EQ(kLength, NonAsciiStart(chars, kLength));
+    for (int length = 0; length <= kLength; length++) {
+      CHECK_EQ(length, NonAsciiStart(chars, length));
+    }
+    for (int pos = 0; pos < kLength; pos++) {
+      chars[pos] = 0x80;
+      int result = NonAsciiStart(chars, kLength);
+      CHECK_LE(result, pos);
+      CHECK_LT(pos - result, static_cast<int>(kIntptrSize));
+      chars[pos] = 'a';
+    }
+  }
+}
+
+TEST(UnicodeTest, CopyAsciiChars) {
+  // Place a single non-ascii byte at every offset, and check that
+  // CopyAsciiChars widens exactly the prefix it reports, and that it stops
+  // at most a word before the non-ascii byte.
+  static constexpr int kLength = 80;
+  uint8_t chars[kLength];
+  for (int i = 0; i < kLength; i++) chars[i] = 'a' + i % 26;
+  uint16_t copy[kLength];
+  CHECK_EQ(kLength, CopyAsciiChars(copy, chars, kLength));
+  for (int i = 0; i < kLength; i++) CHECK_EQ(chars[i], copy[i]);
+  for (int pos = 0; pos < kLength; pos++) {
+    uint8_t saved = chars[pos];
+    chars[pos] = 0xC3;
+    memset(copy, 0, sizeof(copy));
+    int result = CopyAsciiChars(copy, chars, kLength);
+    CHECK_LE(result, pos);
+    CHECK_LT(pos - result, static_cast<int>(kIntptrSize));
+    for (int i = 0; i < result; i++) CHECK_EQ(chars[i], copy[i]);
+    for (int i = result; i < kLength; i++) CHECK_EQ(0, copy[i]);
+    chars[pos] = saved;
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -150,6 +150,52 @@ TEST_F(DisjointAllocationPoolTest, MergingSkipLargerSrcWithGap) {
   CheckPool(a, {{10, 5}, {20, 15}, {36, 4}});
 }
 
+void CheckProtectedInstructionsRoundTrip(
+    std::initializer_list<uint32_t> offsets) {
+  std::vector<trap_handler::ProtectedInstructionData> instructions;
+  for (uint32_t offset : offsets) instructions.push_back({offset});
+  base::OwnedVector<uint8_t> encoded =
+      WasmCode::EncodeProtectedInstructions(base::VectorOf(instructions));
+  std::vector<trap_handler::ProtectedInstructionData> decoded =
+      WasmCode::DecodeProtectedInstructions(encoded.as_vector());
+  ASSERT_EQ(instructions.size(), decoded.size());
+  for (size_t i = 0; i < instructions.size(); ++i) {
+    EXPECT_EQ(instructions[i].instr_offset, decoded[i].instr_offset);
+  }
+}
+
+TEST(ProtectedInstructionsTest, Empty) {
+  base::OwnedVector<uint8_t> encoded =
+      WasmCode::EncodeProtectedInstructions({});
+  EXPECT_TRUE(encoded.empty());
+  CheckProtectedInstructionsRoundTrip({});
+}
+
+TEST(ProtectedInstructionsTest, IncreasingOffsets) {
+  CheckProtectedInstructionsRoundTrip({0, 4, 9, 63, 64, 200, 10000, 10001});
+}
+
+TEST(ProtectedInstructionsTest, DuplicateOffsets) {
+  CheckProtectedInstructionsRoundTrip({0, 0, 12, 12, 300, 4999, 5000});
+}
+
+TEST(ProtectedInstructionsTest, LargeOffsets) {
+  CheckProtectedInstructionsRoundTrip(
+      {0, 1, 0x40000000, 0x7ffffffe, 0x7fffffff, 0xffffffff});
+}
+
+TEST(ProtectedInstructionsTest, CompactEncoding) {
+  // Nearby offsets take a single byte each.
+  std::vector<trap_handler::ProtectedInstructionData> instructions;
+  for (uint32_t offset = 100; offset < 500; offset += 7) {
+    instructions.push_back({offset});
+  }
+  base::OwnedVector<uint8_t> encoded =
+      WasmCode::EncodeProtectedInstructions(base::VectorOf(instructions));
+  // Only the first offset needs two bytes.
+  EXPECT_EQ(instructions.size() + 1, encoded.size());
+}
+
 }  // namespace wasm_heap_unittest
 }  // namespace wasm
 }  // namespace internal
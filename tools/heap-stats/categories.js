@@ -143,6 +143,7 @@ export const CATEGORIES = new Map([
       'PROPERTY_CELL_TYPE',
       'PROTOTYPE_INFO_TYPE',
       'PROTOTYPE_USERS_TYPE',
+      'REGEXP_GLOBAL_MATCHES_CACHE_TYPE',
       'REGEXP_MULTIPLE_CACHE_TYPE',
       'RETAINED_MAPS_TYPE',
       'SCOPE_INFO_TYPE',
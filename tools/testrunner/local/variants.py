@@ -236,8 +236,10 @@ INCOMPATIBLE_FLAGS_PER_BUILD_VARIABLE = {
     "lite_mode": INCOMPATIBLE_FLAGS_PER_VARIANT["jitless"],
     "verify_predictable": [
         "--parallel-compile-tasks-for-eager-toplevel",
-        "--parallel-compile-tasks-for-lazy", "--concurrent-recompilation",
-        "--stress-concurrent-allocation", "--stress-concurrent-inlining"
+        "--parallel-compile-tasks-for-lazy",
+        "--parallel-compile-tasks-for-lazy-toplevel",
+        "--concurrent-recompilation", "--stress-concurrent-allocation",
+        "--stress-concurrent-inlining"
     ],
     "dict_property_const_tracking": ["--stress-concurrent-inlining"],
 }
@@ -254,6 +256,7 @@ INCOMPATIBLE_FLAGS_PER_EXTRA_FLAG = {
     ],
     "--parallel-compile-tasks-for-eager-toplevel": ["--predictable"],
     "--parallel-compile-tasks-for-lazy": ["--predictable"],
+    "--parallel-compile-tasks-for-lazy-toplevel": ["--predictable"],
     "--gc-interval=*": ["--gc-interval=*"],
     "--stress_concurrent_allocation":
         INCOMPATIBLE_FLAGS_PER_VARIANT["stress_concurrent_allocation"],